@@ -2,7 +2,12 @@
 
 #include "hooks.h"
 
-PICOTEST_SUITE(mainSuite, testUcdPropertyAccessors);
+PICOTEST_SUITE(mainSuite, testUcdPropertyAccessors, testTextSegmentation,
+               testBidi, testWidth, testIdentifiers, testScripts,
+               testNumeric, testEmoji, testVertical, testJoining,
+               testOrdering, testFiltering, testLookup, testCaseClosure,
+               testUtf8Automata, testCtype, testSpan,
+               testChangesWhen, testGcMasks);
 
 #define PICOTEST_MAINSUITE mainSuite
 #include <picotestRunner.inc>
@@ -0,0 +1,7 @@
+#include <stddef.h>
+#include <stdint.h>
+
+/* C implementation for the C++ tests, see miniucd.hpp. */
+#define MINIUCD_IMPLEMENTATION
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
@@ -0,0 +1,89 @@
+#include <picotest.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Bidirectional Algorithm */
+PICOTEST_SUITE(testBidi, testBidiResolve, testBidiReorder);
+
+/* Expected levels and visual order are given as strings of digits. */
+static void checkBidi(const wchar_t *text, int paragraphLevel,
+                      int expectedParagraphLevel, const char *expectedLevels,
+                      const char *expectedOrder) {
+    uint32_t codepoints[64];
+    unsigned char levels[64];
+    size_t order[64], length, i;
+    void *arena;
+    int level;
+
+    for (length = 0; text[length]; length++) {
+        codepoints[length] = text[length];
+    }
+    arena = malloc(MiniUCD_BidiArenaSize(length) + 1);
+    level = MiniUCD_BidiResolve(codepoints, length, paragraphLevel, arena,
+                                levels);
+    free(arena);
+    PICOTEST_VERIFY(level == expectedParagraphLevel);
+    for (i = 0; i < length; i++) {
+        PICOTEST_VERIFY(levels[i] == expectedLevels[i] - '0');
+    }
+
+    if (!expectedOrder)
+        return;
+    MiniUCD_BidiReorder(codepoints, levels, length, level, order);
+    for (i = 0; i < length; i++) {
+        PICOTEST_VERIFY(order[i] == (size_t)(expectedOrder[i] - '0'));
+    }
+}
+
+PICOTEST_SUITE(testBidiResolve, testBidiParagraphLevel, testBidiWeakTypes,
+               testBidiBrackets, testBidiExplicit);
+PICOTEST_CASE(testBidiParagraphLevel) {
+    const uint32_t ltr[] = {'a', 0x00E9, ' ', '1'};
+    const uint32_t rtl[] = {'a', 0x05D0};
+    PICOTEST_VERIFY(MiniUCD_BidiIsLTR(ltr, 4));
+    PICOTEST_VERIFY(!MiniUCD_BidiIsLTR(rtl, 2));
+
+    checkBidi(L"abc def", MINIUCD_BIDI_AUTO, 0, "0000000", NULL);
+    checkBidi(L"\u05D0\u05D1\u05D2", MINIUCD_BIDI_AUTO, 1, "111", NULL);
+    checkBidi(L"123 \u05D0", MINIUCD_BIDI_AUTO, 1, "22211", NULL); /* P2 */
+    checkBidi(L"\u2067\u05D0\u2069a", MINIUCD_BIDI_AUTO, 0, "0100", NULL);
+    checkBidi(L"abc", 1, 1, "222", NULL);
+    checkBidi(L"\u05D0\u05D1", 0, 0, "11", NULL);
+}
+PICOTEST_CASE(testBidiWeakTypes) {
+    checkBidi(L"\u05D0 123", MINIUCD_BIDI_AUTO, 1, "11222", NULL);
+    checkBidi(L"\u0627 12", MINIUCD_BIDI_AUTO, 1, "1122", NULL); /* W2 */
+    checkBidi(L"\u05D0 1,2", MINIUCD_BIDI_AUTO, 1, "11222", NULL); /* W4 */
+    checkBidi(L"\u05D0 $12", MINIUCD_BIDI_AUTO, 1, "11222", NULL); /* W5 */
+    checkBidi(L"a 12", MINIUCD_BIDI_AUTO, 0, "0000", NULL);         /* W7 */
+    checkBidi(L"\u05D0\u05B8", MINIUCD_BIDI_AUTO, 1, "11", NULL);     /* W1 */
+}
+PICOTEST_CASE(testBidiBrackets) {
+    /* N0: brackets take the direction of their context. */
+    checkBidi(L"a \u05D2(\u05D3)", 0, 0, "001111", NULL);
+    checkBidi(L"a (\u05D3)", 0, 0, "000100", NULL);
+    checkBidi(L"\u05D0 (b)", 1, 1, "111211", NULL);
+    checkBidi(L"\u05D0 \u2329b\u3009", 1, 1, "111211", NULL);
+}
+PICOTEST_CASE(testBidiExplicit) {
+    checkBidi(L"a\u202Bb\u202Cc", 0, 0, "00220", NULL);
+    checkBidi(L"\u202Eabc\u202C", 0, 0, "01110", NULL);
+    checkBidi(L"\u2067abc\u2069", 0, 0, "02220", NULL);
+    checkBidi(L"x\u2068\u05D0b\u2069y", 0, 0, "001200", NULL);
+    checkBidi(L"\u05D0\tb", MINIUCD_BIDI_AUTO, 1, "112", NULL); /* L1 */
+    checkBidi(L"\u05D0 b  ", 1, 1, "11211", NULL);
+}
+
+PICOTEST_CASE(testBidiReorder) {
+    checkBidi(L"abc def", MINIUCD_BIDI_AUTO, 0, "0000000", "0123456");
+    checkBidi(L"\u05D0\u05D1\u05D2", MINIUCD_BIDI_AUTO, 1, "111", "210");
+    checkBidi(L"ab \u05D0\u05D1 cd", MINIUCD_BIDI_AUTO, 0, "00011000",
+              "01243567");
+    checkBidi(L"\u05D0\u05D1 123", MINIUCD_BIDI_AUTO, 1, "111222", "345210");
+    checkBidi(L"\u202Eabc\u202C", 0, 0, "01110", "03214");
+}
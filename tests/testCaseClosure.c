@@ -0,0 +1,60 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Case Closure */
+PICOTEST_SUITE(testCaseClosure, testNextCaseVariant, testCaseCloseRanges);
+
+PICOTEST_CASE(testNextCaseVariant) {
+    /* Simple pairs. */
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant('A') == 'a');
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant('a') == 'A');
+
+    /* Alternating pairs. */
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x0100) == 0x0101);
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x0101) == 0x0100);
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x0139) == 0x013A);
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x013A) == 0x0139);
+
+    /* Larger orbits. */
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant('K') == 'k');
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant('k') == 0x212A);
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x212A) == 'K');
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x01C4) == 0x01C5);
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x01C5) == 0x01C6);
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x01C6) == 0x01C4);
+
+    /* No case variants. */
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant('0') == '0');
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x4E00) == 0x4E00);
+    PICOTEST_VERIFY(MiniUCD_NextCaseVariant(0x10FFFF) == 0x10FFFF);
+}
+
+PICOTEST_CASE(testCaseCloseRanges) {
+    static const uint32_t lower[] = {'a', 'z'};
+    static const uint32_t sigma[] = {0x03C3, 0x03C3};
+    static const uint32_t none[] = {'0', '9', 0x4E00, 0x9FFF};
+    uint32_t closure[16];
+
+    PICOTEST_ASSERT(MiniUCD_CaseCloseRanges(lower, 1, NULL, 0) == 5);
+    PICOTEST_ASSERT(MiniUCD_CaseCloseRanges(lower, 1, closure, 8) == 5);
+    PICOTEST_VERIFY(closure[0] == 'A' && closure[1] == 'Z');
+    PICOTEST_VERIFY(closure[2] == 'a' && closure[3] == 'z');
+    PICOTEST_VERIFY(closure[4] == 0x0130 && closure[5] == 0x0131);
+    PICOTEST_VERIFY(closure[6] == 0x017F && closure[7] == 0x017F);
+    PICOTEST_VERIFY(closure[8] == 0x212A && closure[9] == 0x212A);
+
+    PICOTEST_ASSERT(MiniUCD_CaseCloseRanges(sigma, 1, closure, 8) == 2);
+    PICOTEST_VERIFY(closure[0] == 0x03A3 && closure[1] == 0x03A3);
+    PICOTEST_VERIFY(closure[2] == 0x03C2 && closure[3] == 0x03C3);
+
+    PICOTEST_ASSERT(MiniUCD_CaseCloseRanges(none, 2, closure, 8) == 2);
+    PICOTEST_VERIFY(closure[0] == '0' && closure[1] == '9');
+    PICOTEST_VERIFY(closure[2] == 0x4E00 && closure[3] == 0x9FFF);
+
+    PICOTEST_VERIFY(MiniUCD_CaseCloseRanges(none, 0, closure, 8) == 0);
+}
@@ -0,0 +1,70 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Changes-When Scanners */
+PICOTEST_SUITE(testChangesWhen, testGetChangesWhen, testFirstChangedWhen);
+
+PICOTEST_CASE(testGetChangesWhen) {
+    PICOTEST_VERIFY(MiniUCD_GetChangesWhen('a')
+                    == (MINIUCD_CW_UPPERCASED | MINIUCD_CW_TITLECASED
+                        | MINIUCD_CW_CASEMAPPED));
+    PICOTEST_VERIFY(MiniUCD_GetChangesWhen('A')
+                    == (MINIUCD_CW_LOWERCASED | MINIUCD_CW_CASEFOLDED
+                        | MINIUCD_CW_CASEMAPPED | MINIUCD_CW_NFKC_CASEFOLDED));
+    PICOTEST_VERIFY(MiniUCD_GetChangesWhen('0') == 0);
+
+    /* LATIN CAPITAL LETTER DZ WITH CARON, and its titlecase. */
+    PICOTEST_VERIFY(MiniUCD_GetChangesWhen(0x01C4) & MINIUCD_CW_TITLECASED);
+    PICOTEST_VERIFY(!(MiniUCD_GetChangesWhen(0x01C5)
+                      & MINIUCD_CW_TITLECASED));
+
+    /* NO-BREAK SPACE only changes under NFKC. */
+    PICOTEST_VERIFY(MiniUCD_GetChangesWhen(0x00A0)
+                    == MINIUCD_CW_NFKC_CASEFOLDED);
+
+    /* LATIN SMALL LETTER SHARP S folds to "ss". */
+    PICOTEST_VERIFY(MiniUCD_GetChangesWhen(0x00DF) & MINIUCD_CW_CASEFOLDED);
+    PICOTEST_VERIFY(MiniUCD_GetChangesWhen(0x10FFFF) == 0);
+}
+
+PICOTEST_CASE(testFirstChangedWhen) {
+    /* "hello, world 123" */
+    static const unsigned char lower[] = "hello, world 123";
+    /* "hello, World" */
+    static const unsigned char mixed[] = "hello, World";
+    /* "stra" SHARP S "e" (straße) */
+    static const unsigned char sharp[] = "stra\xC3\x9F"
+                                         "e";
+    /* "abc" NO-BREAK SPACE "def" */
+    static const unsigned char nbsp[] = "abc\xC2\xA0"
+                                        "def";
+    static const unsigned char invalid[] = "ab\xFF"
+                                           "cdefghijK";
+
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenLowercased(lower, 16) == 16);
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenCasefolded(lower, 16) == 16);
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenNFKCCasefolded(lower, 16) == 16);
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenUppercased(lower, 16) == 0);
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenTitlecased(lower, 16) == 0);
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenCasemapped(lower, 16) == 0);
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenLowercased(lower, 0) == 0);
+
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenLowercased(mixed, 12) == 7);
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhen(
+                        mixed, 12, MINIUCD_CW_LOWERCASED | MINIUCD_CW_UPPERCASED)
+                    == 0);
+
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenLowercased(sharp, 7) == 7);
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenCasefolded(sharp, 7) == 4);
+
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenCasefolded(nbsp, 8) == 8);
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenNFKCCasefolded(nbsp, 8) == 3);
+
+    /* Invalid bytes are skipped. */
+    PICOTEST_VERIFY(MiniUCD_FirstChangedWhenLowercased(invalid, 12) == 11);
+}
@@ -0,0 +1,99 @@
+#include <picotest.h>
+#include <cstdint>
+#include <string>
+
+#define MiniUCD_Char uint32_t
+#define MINIUCD_STD_SPECIALIZATIONS
+#include <miniucd.hpp>
+
+/* C++ Support */
+PICOTEST_SUITE(testCpp, testCtypeIs, testCtypeScan, testRegex);
+
+PICOTEST_CASE(testCtypeIs) {
+    std::locale loc(std::locale::classic(), new std::ctype<char32_t>);
+    const std::ctype<char32_t> &ct = std::use_facet<std::ctype<char32_t> >(loc);
+    const std::u32string text = U"A\u03B1\u0663\u3000!";
+    std::ctype_base::mask masks[5];
+    size_t i;
+
+    PICOTEST_VERIFY(ct.is(std::ctype_base::upper, U'A'));
+    PICOTEST_VERIFY(ct.is(std::ctype_base::alpha, U'\u03B1'));
+    PICOTEST_VERIFY(ct.is(std::ctype_base::lower, U'\u03B1'));
+    PICOTEST_VERIFY(ct.is(std::ctype_base::digit, U'\u0663'));
+    PICOTEST_VERIFY(ct.is(std::ctype_base::space, U'\u3000'));
+    PICOTEST_VERIFY(ct.is(std::ctype_base::punct, U'!'));
+    PICOTEST_VERIFY(!ct.is(std::ctype_base::alpha, U'1'));
+    PICOTEST_VERIFY(ct.toupper(U'\u03B1') == U'\u0391');
+
+    /* Bulk classification agrees with single lookups. */
+    PICOTEST_ASSERT(ct.is(text.data(), text.data() + text.size(), masks)
+                    == text.data() + text.size());
+    for (i = 0; i < text.size(); i++) {
+        PICOTEST_VERIFY(((masks[i] & std::ctype_base::alpha) != 0)
+                        == ct.is(std::ctype_base::alpha, text[i]));
+        PICOTEST_VERIFY(((masks[i] & std::ctype_base::digit) != 0)
+                        == ct.is(std::ctype_base::digit, text[i]));
+        PICOTEST_VERIFY(((masks[i] & std::ctype_base::space) != 0)
+                        == ct.is(std::ctype_base::space, text[i]));
+    }
+}
+
+PICOTEST_CASE(testCtypeScan) {
+    std::locale loc(std::locale::classic(), new std::ctype<char32_t>);
+    const std::ctype<char32_t> &ct = std::use_facet<std::ctype<char32_t> >(loc);
+    const std::u32string text = U"Hello \u03BA\u03CC\u03C3\u03BC\u03B5 123";
+    const char32_t *begin = text.data(), *end = begin + text.size();
+
+    PICOTEST_VERIFY(ct.scan_is(std::ctype_base::digit, begin, end) - begin
+                    == 12);
+    PICOTEST_VERIFY(ct.scan_is(std::ctype_base::space, begin, end) - begin
+                    == 5);
+    PICOTEST_VERIFY(ct.scan_is(std::ctype_base::cntrl, begin, end) == end);
+    PICOTEST_VERIFY(ct.scan_not(std::ctype_base::alpha, begin, end) - begin
+                    == 5);
+    PICOTEST_VERIFY(ct.scan_not(std::ctype_base::alpha, begin + 6, end)
+                    - begin == 11);
+    PICOTEST_VERIFY(ct.scan_not(std::ctype_base::print, begin, end) == end);
+}
+
+PICOTEST_CASE(testRegex) {
+    /* Patterns are scanned with the facet of the global locale. */
+    std::locale old = std::locale::global(miniucd::withCtype(std::locale()));
+    std::match_results<std::u32string::const_iterator> m;
+    const std::u32string text = U"123 \u03BA\u03CC\u03C3\u03BC\u03B5!";
+    const std::u32string mixed = U"abc\u03B1\u03B2\u0663x";
+    const std::u32string word = U"  \u00E9t\u00E9_1 ";
+    bool thrown = false;
+
+    std::basic_regex<char32_t> alpha(U"[[:alpha:]]+");
+    PICOTEST_VERIFY(std::regex_search(text, m, alpha));
+    PICOTEST_VERIFY(m.position(0) == 4 && m.length(0) == 5);
+
+    std::basic_regex<char32_t> greek(U"[[:Greek:][:Nd:]]+");
+    PICOTEST_VERIFY(std::regex_search(mixed, m, greek));
+    PICOTEST_VERIFY(m.position(0) == 3 && m.length(0) == 3);
+
+    std::basic_regex<char32_t> w(U"\\w+");
+    PICOTEST_VERIFY(std::regex_search(word, m, w));
+    PICOTEST_VERIFY(m.position(0) == 2 && m.length(0) == 5);
+
+    std::basic_regex<char32_t> icase(U"\u03A3\u03B9\u03C3",
+                                     std::regex_constants::icase);
+    PICOTEST_VERIFY(
+        std::regex_match(std::u32string(U"\u03C3\u0399\u03C2"), icase));
+
+    std::basic_regex<char32_t> letters(U"[[:L:]]{2}");
+    PICOTEST_VERIFY(std::regex_match(std::u32string(U"\u05D0a"), letters));
+
+    try {
+        std::basic_regex<char32_t> unknown(U"[[:nope:]]");
+    } catch (std::regex_error &) {
+        thrown = true;
+    }
+    PICOTEST_VERIFY(thrown);
+
+    std::locale::global(old);
+}
+
+#define PICOTEST_MAINSUITE testCpp
+#include <picotestRunner.inc>
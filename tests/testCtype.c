@@ -0,0 +1,79 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Character Types */
+PICOTEST_SUITE(testCtype, testGetCtype, testGetCtypes, testScanCtype);
+
+PICOTEST_CASE(testGetCtype) {
+    /* ASCII. */
+    PICOTEST_VERIFY(MiniUCD_GetCtype('A')
+                    == (MINIUCD_CTYPE_PRINT | MINIUCD_CTYPE_UPPER
+                        | MINIUCD_CTYPE_ALPHA | MINIUCD_CTYPE_XDIGIT
+                        | MINIUCD_CTYPE_GRAPH | MINIUCD_CTYPE_WORD));
+    PICOTEST_VERIFY(MiniUCD_GetCtype('z')
+                    == (MINIUCD_CTYPE_PRINT | MINIUCD_CTYPE_LOWER
+                        | MINIUCD_CTYPE_ALPHA | MINIUCD_CTYPE_GRAPH
+                        | MINIUCD_CTYPE_WORD));
+    PICOTEST_VERIFY(MiniUCD_GetCtype('7') & MINIUCD_CTYPE_XDIGIT);
+    PICOTEST_VERIFY(MiniUCD_GetCtype('_') & MINIUCD_CTYPE_WORD);
+    PICOTEST_VERIFY(MiniUCD_GetCtype('+') & MINIUCD_CTYPE_PUNCT);
+    PICOTEST_VERIFY(MiniUCD_GetCtype('\t')
+                    == (MINIUCD_CTYPE_SPACE | MINIUCD_CTYPE_CNTRL
+                        | MINIUCD_CTYPE_BLANK));
+    PICOTEST_VERIFY(MiniUCD_GetCtype('\n')
+                    == (MINIUCD_CTYPE_SPACE | MINIUCD_CTYPE_CNTRL));
+    PICOTEST_VERIFY(MiniUCD_GetCtype(' ')
+                    == (MINIUCD_CTYPE_SPACE | MINIUCD_CTYPE_PRINT
+                        | MINIUCD_CTYPE_BLANK));
+
+    /* Non-ASCII. */
+    PICOTEST_VERIFY(MiniUCD_GetCtype(0x0391) /* GREEK CAPITAL LETTER ALPHA */
+                    == (MINIUCD_CTYPE_PRINT | MINIUCD_CTYPE_UPPER
+                        | MINIUCD_CTYPE_ALPHA | MINIUCD_CTYPE_GRAPH
+                        | MINIUCD_CTYPE_WORD));
+    PICOTEST_VERIFY(MiniUCD_GetCtype(0x03B1) & MINIUCD_CTYPE_LOWER);
+    PICOTEST_VERIFY(MiniUCD_GetCtype(0x0663) /* ARABIC-INDIC DIGIT THREE */
+                    == (MINIUCD_CTYPE_PRINT | MINIUCD_CTYPE_DIGIT
+                        | MINIUCD_CTYPE_GRAPH | MINIUCD_CTYPE_WORD));
+    PICOTEST_VERIFY(MiniUCD_GetCtype(0x3000) /* IDEOGRAPHIC SPACE */
+                    == (MINIUCD_CTYPE_SPACE | MINIUCD_CTYPE_PRINT
+                        | MINIUCD_CTYPE_BLANK));
+    PICOTEST_VERIFY(MiniUCD_GetCtype(0x2028) /* LINE SEPARATOR */
+                    == (MINIUCD_CTYPE_SPACE | MINIUCD_CTYPE_PRINT));
+    PICOTEST_VERIFY((MiniUCD_GetCtype(0x4E00) & MINIUCD_CTYPE_ALNUM)
+                    == MINIUCD_CTYPE_ALPHA);
+    PICOTEST_VERIFY(MiniUCD_GetCtype(0xFF21) /* FULLWIDTH A */
+                    & MINIUCD_CTYPE_UPPER);
+    PICOTEST_VERIFY(!(MiniUCD_GetCtype(0xFF21) & MINIUCD_CTYPE_XDIGIT));
+    PICOTEST_VERIFY(MiniUCD_GetCtype(0xE000) == 0);
+    PICOTEST_VERIFY(MiniUCD_GetCtype(0x10FFFF) == 0);
+}
+
+PICOTEST_CASE(testGetCtypes) {
+    static const uint32_t text[] = {'a',    ' ',    0x0391, 0x03B1, 0x03B2,
+                                    0x0663, 0x3000, 0x4E00, 0x4E01, '\t'};
+    unsigned short masks[sizeof(text) / sizeof(*text)];
+    size_t i;
+
+    MiniUCD_GetCtypes(text, sizeof(text) / sizeof(*text), masks);
+    for (i = 0; i < sizeof(text) / sizeof(*text); i++) {
+        PICOTEST_VERIFY(masks[i] == MiniUCD_GetCtype(text[i]));
+    }
+}
+
+PICOTEST_CASE(testScanCtype) {
+    static const uint32_t text[] = {0x03B1, 0x03B2, 0x3000, 0x0663, '.'};
+
+    PICOTEST_VERIFY(MiniUCD_ScanCtype(text, 5, MINIUCD_CTYPE_SPACE) == 2);
+    PICOTEST_VERIFY(MiniUCD_ScanCtype(text, 5, MINIUCD_CTYPE_DIGIT) == 3);
+    PICOTEST_VERIFY(MiniUCD_ScanCtype(text, 5, MINIUCD_CTYPE_CNTRL) == 5);
+    PICOTEST_VERIFY(MiniUCD_ScanCtype(text, 0, MINIUCD_CTYPE_ALPHA) == 0);
+    PICOTEST_VERIFY(MiniUCD_ScanNotCtype(text, 5, MINIUCD_CTYPE_ALPHA) == 2);
+    PICOTEST_VERIFY(MiniUCD_ScanNotCtype(text, 5, MINIUCD_CTYPE_GRAPH) == 2);
+    PICOTEST_VERIFY(MiniUCD_ScanNotCtype(text, 5, MINIUCD_CTYPE_PRINT) == 5);
+}
@@ -0,0 +1,82 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Emoji Sequences */
+PICOTEST_SUITE(testEmoji, testEmojiSequenceTypes, testEmojiPresentation,
+               testEmojiIterate);
+
+/* Check that text starts with a single emoji sequence of the given type. */
+static int checkSequence(const uint32_t *text, size_t length,
+                         MiniUCD_EmojiType type) {
+    MiniUCD_EmojiSequence seq;
+    if (!MiniUCD_NextEmojiSequence(text, length, 0, &seq)) return 0;
+    return (seq.start == 0 && seq.end == length && seq.type == type);
+}
+
+#define CHECK_SEQUENCE(type, ...)                                             \
+    do {                                                                      \
+        const uint32_t text[] = {__VA_ARGS__};                                \
+        PICOTEST_VERIFY(checkSequence(text, sizeof(text) / sizeof(*text),     \
+                                      MINIUCD_EMOJISEQ_##type));              \
+    } while (0)
+
+PICOTEST_CASE(testEmojiSequenceTypes) {
+    CHECK_SEQUENCE(BASIC, 0x1F600);                         /* 😀 */
+    CHECK_SEQUENCE(BASIC, 0x00A9, 0xFE0F);                  /* ©️ */
+    CHECK_SEQUENCE(KEYCAP, '1', 0xFE0F, 0x20E3);            /* 1️⃣ */
+    CHECK_SEQUENCE(KEYCAP, '#', 0x20E3);
+    CHECK_SEQUENCE(MODIFIER, 0x1F44D, 0x1F3FD);             /* 👍🏽 */
+    CHECK_SEQUENCE(MODIFIER, 0x261D, 0x1F3FB);              /* ☝🏻 */
+    CHECK_SEQUENCE(FLAG, 0x1F1EB, 0x1F1F7);                 /* 🇫🇷 */
+    CHECK_SEQUENCE(TAG, 0x1F3F4, 0xE0067, 0xE0062, 0xE0073, 0xE0063,
+                   0xE0074, 0xE007F);                       /* Scotland */
+    CHECK_SEQUENCE(ZWJ, 0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F467);
+    CHECK_SEQUENCE(ZWJ, 0x1F3F3, 0xFE0F, 0x200D, 0x1F308);  /* 🏳️‍🌈 */
+    CHECK_SEQUENCE(ZWJ, 0x1F469, 0x1F3FD, 0x200D, 0x1F4BB); /* 👩🏽‍💻 */
+}
+
+PICOTEST_CASE(testEmojiPresentation) {
+    const uint32_t text1[] = {0x00A9, 'a', '1', 0x1F1EB};
+    const uint32_t text2[] = {0x1F600, 0xFE0E};
+    const uint32_t text3[] = {0x1F468, 0x200D, 'a'};
+    MiniUCD_EmojiSequence seq;
+
+    /* Text presentation. */
+    PICOTEST_VERIFY(!MiniUCD_NextEmojiSequence(text1, 4, 0, &seq));
+    PICOTEST_VERIFY(!MiniUCD_NextEmojiSequence(text2, 2, 0, &seq));
+
+    /* Dangling ZWJ. */
+    PICOTEST_ASSERT(MiniUCD_NextEmojiSequence(text3, 3, 0, &seq));
+    PICOTEST_VERIFY(seq.start == 0);
+    PICOTEST_VERIFY(seq.end == 1);
+    PICOTEST_VERIFY(seq.type == MINIUCD_EMOJISEQ_BASIC);
+}
+
+PICOTEST_CASE(testEmojiIterate) {
+    const uint32_t text[] = {'a', 0x1F600, 'b', 0x1F44D, 0x1F3FD, 'c',
+                             0x1F1EB, 0x1F1F7, 0x1F1EA};
+    const size_t length = sizeof(text) / sizeof(*text);
+    MiniUCD_EmojiSequence seq;
+    size_t i, nb = 0;
+
+    for (i = 0; MiniUCD_NextEmojiSequence(text, length, i, &seq); i = seq.end) {
+        switch (nb++) {
+        case 0:
+            PICOTEST_VERIFY(seq.start == 1 && seq.end == 2);
+            break;
+        case 1:
+            PICOTEST_VERIFY(seq.start == 3 && seq.end == 5);
+            break;
+        case 2:
+            PICOTEST_VERIFY(seq.start == 6 && seq.end == 8);
+            PICOTEST_VERIFY(seq.type == MINIUCD_EMOJISEQ_FLAG);
+            break;
+        }
+    }
+    PICOTEST_VERIFY(nb == 3);
+}
@@ -0,0 +1,94 @@
+#include <picotest.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Text Filtering */
+PICOTEST_SUITE(testFiltering, testTrim, testStripDefaultIgnorables,
+               testCollapseWhitespace);
+
+static int checkTrim(const char *text, int options, size_t start,
+                     size_t length) {
+    size_t s;
+    size_t l = MiniUCD_Trim((const unsigned char *)text, strlen(text),
+                            options, &s);
+    return (s == start && l == length);
+}
+
+PICOTEST_CASE(testTrim) {
+    PICOTEST_VERIFY(checkTrim("", 0, 0, 0));
+    PICOTEST_VERIFY(checkTrim("abc", 0, 0, 3));
+    PICOTEST_VERIFY(checkTrim(" \t\r\nabc def\n ", 0, 4, 7));
+    PICOTEST_VERIFY(checkTrim("   ", 0, 3, 0));
+    /* NBSP, IDEOGRAPHIC SPACE */
+    PICOTEST_VERIFY(checkTrim("\xC2\xA0" "abc\xE3\x80\x80", 0, 2, 3));
+    PICOTEST_VERIFY(checkTrim("\xC2\xA0" "abc\xE3\x80\x80",
+                              MINIUCD_FILTER_PATTERN_SPACE, 0, 8));
+    /* LRM is Pattern_White_Space but not White_Space */
+    PICOTEST_VERIFY(checkTrim("\xE2\x80\x8E" "a", 0, 0, 4));
+    PICOTEST_VERIFY(
+        checkTrim("\xE2\x80\x8E" "a", MINIUCD_FILTER_PATTERN_SPACE, 3, 1));
+    /* Invalid bytes */
+    PICOTEST_VERIFY(checkTrim(" \x80 ", 0, 1, 1));
+}
+
+static int checkStrip(const char *text, int options, const char *expected) {
+    unsigned char out[256];
+    size_t length = MiniUCD_StripDefaultIgnorables(
+        (const unsigned char *)text, strlen(text), options, out);
+    return (length == strlen(expected) && !memcmp(out, expected, length));
+}
+
+PICOTEST_CASE(testStripDefaultIgnorables) {
+    char buffer[64];
+    size_t length;
+
+    PICOTEST_VERIFY(checkStrip("", 0, ""));
+    PICOTEST_VERIFY(checkStrip("plain ASCII text, nothing to strip", 0,
+                               "plain ASCII text, nothing to strip"));
+    /* BOM, ZWSP, SOFT HYPHEN */
+    PICOTEST_VERIFY(checkStrip("\xEF\xBB\xBF" "a\xE2\x80\x8B" "b\xC2\xAD" "c",
+                               0, "abc"));
+    /* Controls */
+    PICOTEST_VERIFY(checkStrip("a\x01\tb\x7F", 0, "a\x01\tb\x7F"));
+    PICOTEST_VERIFY(
+        checkStrip("a\x01\tb\x7F", MINIUCD_FILTER_CONTROLS, "a\tb"));
+    /* ZWJ in emoji sequence */
+    PICOTEST_VERIFY(checkStrip("\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9",
+                               0, "\xF0\x9F\x91\xA8\xF0\x9F\x91\xA9"));
+    PICOTEST_VERIFY(checkStrip("\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9",
+                               MINIUCD_FILTER_KEEP_JOINERS,
+                               "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9"));
+
+    /* In place */
+    strcpy(buffer, "0123456789\xE2\x80\x8B" "0123456789\xE2\x81\xA0!");
+    length = MiniUCD_StripDefaultIgnorables((unsigned char *)buffer,
+                                            strlen(buffer), 0,
+                                            (unsigned char *)buffer);
+    PICOTEST_VERIFY(length == 21);
+    PICOTEST_VERIFY(!memcmp(buffer, "01234567890123456789!", 21));
+}
+
+static int checkCollapse(const char *text, int options, const char *expected) {
+    unsigned char out[256];
+    size_t length = MiniUCD_CollapseWhitespace((const unsigned char *)text,
+                                               strlen(text), options, out);
+    return (length == strlen(expected) && !memcmp(out, expected, length));
+}
+
+PICOTEST_CASE(testCollapseWhitespace) {
+    PICOTEST_VERIFY(checkCollapse("", 0, ""));
+    PICOTEST_VERIFY(checkCollapse("a b", 0, "a b"));
+    PICOTEST_VERIFY(checkCollapse("  a \t\r\n b  ", 0, " a b "));
+    /* NBSP, EM SPACE */
+    PICOTEST_VERIFY(checkCollapse("a\xC2\xA0\xE2\x80\x83" "b", 0, "a b"));
+    PICOTEST_VERIFY(checkCollapse("a\xC2\xA0\xE2\x80\x83" "b",
+                                  MINIUCD_FILTER_PATTERN_SPACE,
+                                  "a\xC2\xA0\xE2\x80\x83" "b"));
+    /* Invalid bytes */
+    PICOTEST_VERIFY(checkCollapse("a \xFF  b", 0, "a \xFF b"));
+}
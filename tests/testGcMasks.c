@@ -0,0 +1,85 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* General Category Masks */
+PICOTEST_SUITE(testGcMasks, testGcMaskConstants, testGetGcMask,
+               testGetGcMasks, testSpanGcMask);
+
+PICOTEST_CASE(testGcMaskConstants) {
+    PICOTEST_VERIFY(MINIUCD_GC_MASK_LU == 1UL << MINIUCD_GC_LU);
+    PICOTEST_VERIFY(MINIUCD_GC_MASK_L
+                    == (MINIUCD_GC_MASK_LU | MINIUCD_GC_MASK_LL
+                        | MINIUCD_GC_MASK_LT | MINIUCD_GC_MASK_LM
+                        | MINIUCD_GC_MASK_LO));
+    PICOTEST_VERIFY(MINIUCD_GC_MASK_LC
+                    == (MINIUCD_GC_MASK_LU | MINIUCD_GC_MASK_LL
+                        | MINIUCD_GC_MASK_LT));
+    PICOTEST_VERIFY(MINIUCD_GC_MASK_N
+                    == (MINIUCD_GC_MASK_ND | MINIUCD_GC_MASK_NL
+                        | MINIUCD_GC_MASK_NO));
+    PICOTEST_VERIFY((MINIUCD_GC_MASK_C | MINIUCD_GC_MASK_L | MINIUCD_GC_MASK_M
+                     | MINIUCD_GC_MASK_N | MINIUCD_GC_MASK_P
+                     | MINIUCD_GC_MASK_S | MINIUCD_GC_MASK_Z)
+                    == ((1UL << (MINIUCD_GC_NBVALUES + 1)) - 2));
+}
+
+PICOTEST_CASE(testGetGcMask) {
+    PICOTEST_VERIFY(MiniUCD_GetGcMask('A') == MINIUCD_GC_MASK_LU);
+    PICOTEST_VERIFY(MiniUCD_GetGcMask('_') == MINIUCD_GC_MASK_PC);
+    PICOTEST_VERIFY(MiniUCD_GetGcMask('\n') & MINIUCD_GC_MASK_C);
+    PICOTEST_VERIFY(MiniUCD_GetGcMask(0x01C5) & MINIUCD_GC_MASK_LC);
+    PICOTEST_VERIFY(MiniUCD_GetGcMask(0x0663) & MINIUCD_GC_MASK_N);
+    PICOTEST_VERIFY(MiniUCD_GetGcMask(0x0301) & MINIUCD_GC_MASK_M);
+    PICOTEST_VERIFY(MiniUCD_GetGcMask(0x3000) == MINIUCD_GC_MASK_ZS);
+    PICOTEST_VERIFY(MiniUCD_GetGcMask(0x10FFFF) == MINIUCD_GC_MASK_CN);
+}
+
+PICOTEST_CASE(testGetGcMasks) {
+    static const uint32_t text[] = {'a',    '1',    ' ',    0x0391, 0x03B1,
+                                    0x03B2, 0x0301, 0x4E00, 0x4E01, 0xE000};
+    unsigned long masks[sizeof(text) / sizeof(*text)];
+    size_t i;
+
+    MiniUCD_GetGcMasks(text, sizeof(text) / sizeof(*text), masks);
+    for (i = 0; i < sizeof(text) / sizeof(*text); i++) {
+        PICOTEST_VERIFY(masks[i] == 1UL << MiniUCD_GetProperty_Gc(text[i]));
+    }
+}
+
+PICOTEST_CASE(testSpanGcMask) {
+    /* "ab" ALPHA COMBINING ACUTE ACCENT "1" ARABIC-INDIC DIGIT ONE " " */
+    static const unsigned char text[] = "ab\xCE\xB1\xCC\x81"
+                                        "1\xD9\xA1 ";
+    static const unsigned char invalid[] = "ab\xFF"
+                                           "c";
+    size_t length = sizeof(text) - 1;
+    unsigned long word = MINIUCD_GC_MASK_L | MINIUCD_GC_MASK_M;
+
+    PICOTEST_VERIFY(MiniUCD_SpanGcMask(text, length, MINIUCD_GC_MASK_L, 1)
+                    == 4);
+    PICOTEST_VERIFY(MiniUCD_SpanGcMask(text, length, word, 1) == 6);
+    PICOTEST_VERIFY(MiniUCD_SpanGcMask(text, length, MINIUCD_GC_MASK_N, 0)
+                    == 6);
+    PICOTEST_VERIFY(MiniUCD_SpanGcMask(text, 0, word, 1) == 0);
+    PICOTEST_VERIFY(MiniUCD_SpanBackGcMask(text, length, MINIUCD_GC_MASK_Z,
+                                           1)
+                    == length - 1);
+    PICOTEST_VERIFY(MiniUCD_SpanBackGcMask(text, length - 1,
+                                           MINIUCD_GC_MASK_N, 1)
+                    == 6);
+    PICOTEST_VERIFY(MiniUCD_SpanBackGcMask(text, 6, MINIUCD_GC_MASK_M, 1)
+                    == 4);
+    PICOTEST_VERIFY(MiniUCD_SpanBackGcMask(text, 6, MINIUCD_GC_MASK_N, 0)
+                    == 0);
+
+    /* Invalid bytes never match. */
+    PICOTEST_VERIFY(MiniUCD_SpanGcMask(invalid, 4, MINIUCD_GC_MASK_L, 1)
+                    == 2);
+    PICOTEST_VERIFY(MiniUCD_SpanBackGcMask(invalid, 3, MINIUCD_GC_MASK_L, 0)
+                    == 2);
+}
@@ -0,0 +1,52 @@
+#include <picotest.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Identifiers */
+PICOTEST_SUITE(testIdentifiers, testScanIdentifierAscii,
+               testScanIdentifierUnicode, testScanIdentifierInvalid);
+
+static size_t scan(const char *utf8, int options) {
+    return MiniUCD_ScanIdentifier((const unsigned char *)utf8, strlen(utf8),
+                                  options);
+}
+
+PICOTEST_CASE(testScanIdentifierAscii) {
+    PICOTEST_VERIFY(scan("", 0) == 0);
+    PICOTEST_VERIFY(scan("hello world", 0) == 5);
+    PICOTEST_VERIFY(scan("x1+y", 0) == 2);
+    PICOTEST_VERIFY(scan("1x", 0) == 0);
+    PICOTEST_VERIFY(scan("_x1", 0) == 0);
+    PICOTEST_VERIFY(scan("_x1", MINIUCD_IDENTIFIER_UNDERSCORE) == 3);
+    PICOTEST_VERIFY(scan("x__", MINIUCD_IDENTIFIER_UNDERSCORE) == 3);
+    PICOTEST_VERIFY(MiniUCD_ScanIdentifier((const unsigned char *)"abc", 2,
+                                           0) == 2);
+}
+
+PICOTEST_CASE(testScanIdentifierUnicode) {
+    PICOTEST_VERIFY(scan("caf\xC3\xA9!", 0) == 5);         /* café */
+    PICOTEST_VERIFY(scan("\xCE\xB1\xCE\xB2 ", 0) == 4);    /* αβ */
+    PICOTEST_VERIFY(scan("\xE5\xA4\x89\xE6\x95\xB0", 0) == 6); /* 変数 */
+    PICOTEST_VERIFY(scan("a\xE2\x80\xBF" "b", 0) == 5);    /* a‿b */
+    PICOTEST_VERIFY(scan("\xCC\x81" "a", 0) == 0);         /* U+0301 */
+    PICOTEST_VERIFY(scan("\xF0\x9D\x90\x80", 0) == 4);     /* U+1D400 */
+
+    /* NFKC_Quick_Check=No. */
+    PICOTEST_VERIFY(scan("\xEF\xAC\x81x", 0) == 4);        /* U+FB01 */
+    PICOTEST_VERIFY(scan("\xEF\xAC\x81x", MINIUCD_IDENTIFIER_NFKC) == 0);
+    PICOTEST_VERIFY(scan("a\xEF\xBC\x91", 0) == 4);        /* U+FF11 */
+    PICOTEST_VERIFY(scan("a\xEF\xBC\x91", MINIUCD_IDENTIFIER_NFKC) == 1);
+}
+
+PICOTEST_CASE(testScanIdentifierInvalid) {
+    PICOTEST_VERIFY(scan("ab\xC3", 0) == 2);               /* Truncated */
+    PICOTEST_VERIFY(scan("a\xC0\x80", 0) == 1);            /* Overlong */
+    PICOTEST_VERIFY(scan("a\xED\xA0\x80", 0) == 1);        /* Surrogate */
+    PICOTEST_VERIFY(scan("a\xF4\x90\x80\x80", 0) == 1);    /* > U+10FFFF */
+    PICOTEST_VERIFY(scan("a\x80", 0) == 1);
+}
@@ -0,0 +1,55 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Cursive Joining */
+PICOTEST_SUITE(testJoining, testJoiningArabic, testJoiningSyriac);
+
+/* Expected forms are given as a list of length values. */
+static void checkForms(const uint32_t *text, size_t length, ...) {
+    unsigned char forms[64];
+    size_t i;
+    va_list expected;
+
+    MiniUCD_ResolveJoiningForms(text, length, forms);
+
+    va_start(expected, length);
+    for (i = 0; i < length; i++) {
+        PICOTEST_VERIFY(va_arg(expected, int) == forms[i]);
+    }
+    va_end(expected);
+}
+
+#define CHECK_FORMS(text, ...)                                                \
+    checkForms(text, sizeof(text) / sizeof(*text), __VA_ARGS__)
+
+PICOTEST_CASE(testJoiningArabic) {
+    const uint32_t bism[] = {0x0628, 0x0633, 0x0645};
+    const uint32_t alif[] = {0x0627, 0x0628, 0x062A, ' ', 0x0628};
+    const uint32_t harakat[] = {0x0628, 0x064E, 0x0633, 0x064E};
+    const uint32_t zwj[] = {0x0628, 0x200D, 'a'};
+
+    CHECK_FORMS(bism, MINIUCD_FORM_INIT, MINIUCD_FORM_MEDI, MINIUCD_FORM_FINA);
+    CHECK_FORMS(alif, MINIUCD_FORM_ISOL, MINIUCD_FORM_INIT, MINIUCD_FORM_FINA,
+                MINIUCD_FORM_NONE, MINIUCD_FORM_ISOL);
+    CHECK_FORMS(harakat, MINIUCD_FORM_INIT, MINIUCD_FORM_NONE,
+                MINIUCD_FORM_FINA, MINIUCD_FORM_NONE);
+    CHECK_FORMS(zwj, MINIUCD_FORM_INIT, MINIUCD_FORM_FINA, MINIUCD_FORM_NONE);
+}
+
+PICOTEST_CASE(testJoiningSyriac) {
+    const uint32_t alaph[] = {0x0710, ' ', 0x0712, 0x0710};
+    const uint32_t fin2[] = {0x0710, 0x0710};
+    const uint32_t fin3[] = {0x0715, 0x0710};
+    const uint32_t med2[] = {0x0712, 0x0710, 0x0712};
+
+    CHECK_FORMS(alaph, MINIUCD_FORM_ISOL, MINIUCD_FORM_NONE, MINIUCD_FORM_INIT,
+                MINIUCD_FORM_FINA);
+    CHECK_FORMS(fin2, MINIUCD_FORM_ISOL, MINIUCD_FORM_FIN2);
+    CHECK_FORMS(fin3, MINIUCD_FORM_ISOL, MINIUCD_FORM_FIN3);
+    CHECK_FORMS(med2, MINIUCD_FORM_INIT, MINIUCD_FORM_MED2, MINIUCD_FORM_ISOL);
+}
@@ -0,0 +1,97 @@
+#include <picotest.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+#define LOOKUP_PROPERTY(name) MiniUCD_LookupProperty((name), strlen(name))
+#define LOOKUP_VALUE(property, name)                                          \
+    MiniUCD_LookupPropertyValue((property), (name), strlen(name))
+
+/* Property Lookup */
+PICOTEST_SUITE(testLookup, testLookupProperty, testLookupPropertyValue,
+               testGetPropertyRanges);
+
+PICOTEST_CASE(testLookupProperty) {
+    PICOTEST_VERIFY(LOOKUP_PROPERTY("sc") == MINIUCD_SC);
+    PICOTEST_VERIFY(LOOKUP_PROPERTY("Script") == MINIUCD_SC);
+    PICOTEST_VERIFY(LOOKUP_PROPERTY("is_script") == MINIUCD_SC);
+    PICOTEST_VERIFY(LOOKUP_PROPERTY("General Category") == MINIUCD_GC);
+    PICOTEST_VERIFY(LOOKUP_PROPERTY("WHITE-SPACE") == MINIUCD_WSPACE);
+    PICOTEST_VERIFY(LOOKUP_PROPERTY("Emoji") == MINIUCD_EMOJI);
+    PICOTEST_VERIFY(LOOKUP_PROPERTY("scx") == MINIUCD_SCX);
+    PICOTEST_VERIFY(LOOKUP_PROPERTY("Scripts") == 0);
+    PICOTEST_VERIFY(LOOKUP_PROPERTY("") == 0);
+    PICOTEST_VERIFY(MiniUCD_LookupProperty("script", 3) == 0);
+}
+
+PICOTEST_CASE(testLookupPropertyValue) {
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_SC, "Greek") == MINIUCD_SC_GREK);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_SC, "grek") == MINIUCD_SC_GREK);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_SC, "IsGreek") == MINIUCD_SC_GREK);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_SCX, "Greek") == MINIUCD_SC_GREK);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_GC, "Lu") == MINIUCD_GC_LU);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_GC, "uppercase letter") ==
+                    MINIUCD_GC_LU);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_GC, "L") > MINIUCD_GC_NBVALUES);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_GC, "Letter") ==
+                    LOOKUP_VALUE(MINIUCD_GC, "L"));
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_EMOJI, "Yes") == 1);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_EMOJI, "f") == 0);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_EMOJI, "Maybe") == -1);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_SC, "Lu") == -1);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_GC, "Greek") == -1);
+    PICOTEST_VERIFY(LOOKUP_VALUE(MINIUCD_NA, "Greek") == -1);
+    PICOTEST_VERIFY(LOOKUP_VALUE(0, "Greek") == -1);
+}
+
+PICOTEST_CASE(testGetPropertyRanges) {
+    uint32_t ranges[8], c;
+    size_t nb, i;
+    int value;
+
+    /* ASCII hex digits. */
+    PICOTEST_ASSERT(MiniUCD_GetPropertyRanges(MINIUCD_AHEX, 1, NULL, 0) ==
+                    3);
+    PICOTEST_ASSERT(MiniUCD_GetPropertyRanges(MINIUCD_AHEX, 1, ranges, 4) ==
+                    3);
+    PICOTEST_VERIFY(ranges[0] == '0' && ranges[1] == '9');
+    PICOTEST_VERIFY(ranges[2] == 'A' && ranges[3] == 'F');
+    PICOTEST_VERIFY(ranges[4] == 'a' && ranges[5] == 'f');
+    PICOTEST_ASSERT(MiniUCD_GetPropertyRanges(MINIUCD_AHEX, 0, ranges, 4) ==
+                    4);
+    PICOTEST_VERIFY(ranges[0] == 0 && ranges[1] == '0' - 1);
+
+    /* Truncated result. */
+    PICOTEST_VERIFY(MiniUCD_GetPropertyRanges(MINIUCD_SC, MINIUCD_SC_GREK,
+                                              ranges, 4) > 4);
+    PICOTEST_VERIFY(ranges[0] == 0x0370 && ranges[1] == 0x0373);
+    for (i = 0; i < 4; i++) {
+        for (c = ranges[i * 2]; c <= ranges[i * 2 + 1]; c++) {
+            PICOTEST_VERIFY(MiniUCD_GetProperty_Sc(c) == MINIUCD_SC_GREK);
+        }
+    }
+
+    /* Groups are merged. */
+    value = LOOKUP_VALUE(MINIUCD_GC, "LC");
+    nb = MiniUCD_GetPropertyRanges(MINIUCD_GC, value, ranges, 4);
+    PICOTEST_VERIFY(nb > 4);
+    PICOTEST_VERIFY(ranges[0] == 'A' && ranges[1] == 'Z');
+    PICOTEST_VERIFY(ranges[2] == 'a' && ranges[3] == 'z');
+    PICOTEST_VERIFY(ranges[4] == 0x00B5 && ranges[5] == 0x00B5);
+    PICOTEST_VERIFY(ranges[6] == 0x00C0 && ranges[7] == 0x00D6);
+
+    /* Script extensions. */
+    nb = MiniUCD_GetPropertyRanges(MINIUCD_SCX, MINIUCD_SC_GREK, ranges, 4);
+    PICOTEST_VERIFY(nb > 4);
+    PICOTEST_VERIFY(ranges[0] == 0x00B7 && ranges[1] == 0x00B7);
+
+    /* Unsupported. */
+    PICOTEST_VERIFY(MiniUCD_GetPropertyRanges(MINIUCD_NV, 1, ranges, 4) == 0);
+    PICOTEST_VERIFY(MiniUCD_GetPropertyRanges(MINIUCD_GC, 0, ranges, 4) == 0);
+    PICOTEST_VERIFY(MiniUCD_GetPropertyRanges(MINIUCD_GC, 1000, ranges, 4) ==
+                    0);
+}
@@ -0,0 +1,70 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Numeric Values */
+PICOTEST_SUITE(testNumeric, testNumericValue, testDigitValue,
+               testParseDigits);
+
+static int checkRational(uint32_t c, int64_t numerator, int64_t denominator) {
+    int64_t n, d;
+    if (!MiniUCD_GetNumericValue(c, &n, &d)) return 0;
+    return (n == numerator && d == denominator);
+}
+
+PICOTEST_CASE(testNumericValue) {
+    double value;
+    int64_t n, d;
+
+    PICOTEST_VERIFY(checkRational('7', 7, 1));
+    PICOTEST_VERIFY(checkRational(0x00BD, 1, 2));             /* ½ */
+    PICOTEST_VERIFY(checkRational(0x0F33, -1, 2));            /* ༳ */
+    PICOTEST_VERIFY(checkRational(0x2187, 50000, 1));         /* ↇ */
+    PICOTEST_VERIFY(checkRational(0x16B61, 1000000000000, 1));
+    PICOTEST_VERIFY(checkRational(0x4EAC, 10000000000000000, 1)); /* 京 */
+    PICOTEST_VERIFY(!MiniUCD_GetNumericValue('a', &n, &d));
+
+    PICOTEST_VERIFY(MiniUCD_GetNumericDouble(0x00BE, &value));  /* ¾ */
+    PICOTEST_VERIFY(value == 0.75);
+    PICOTEST_VERIFY(!MiniUCD_GetNumericDouble(0x0020, &value));
+}
+
+PICOTEST_CASE(testDigitValue) {
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue('0') == 0);
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue('9') == 9);
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue(0x0663) == 3);  /* ٣ */
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue(0x096F) == 9);  /* ९ */
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue(0xFF15) == 5);  /* ５ */
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue(0x1D7D9) == 1); /* 𝟙 */
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue('a') == -1);
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue(0x00B2) == -1); /* ² (Digit) */
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue(0x00BD) == -1);
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue(0x0010) == -1);
+    PICOTEST_VERIFY(MiniUCD_GetDigitValue(0x10FFFF) == -1);
+}
+
+PICOTEST_CASE(testParseDigits) {
+    const uint32_t ascii[] = {'1', '2', '3', 'x'};
+    const uint32_t arabic[] = {0x0661, 0x0669, 0x0660, '!'};
+    const uint32_t mixed[] = {0x0661, '2'};
+    const uint32_t big[] = {'1', '8', '4', '4', '6', '7', '4', '4', '0', '7',
+                            '3', '7', '0', '9', '5', '5', '1', '6', '1', '5',
+                            '9'};
+    uint64_t value;
+
+    PICOTEST_VERIFY(MiniUCD_ParseDigits(ascii, 4, &value) == 3);
+    PICOTEST_VERIFY(value == 123);
+    PICOTEST_VERIFY(MiniUCD_ParseDigits(arabic, 4, &value) == 3);
+    PICOTEST_VERIFY(value == 190);
+    PICOTEST_VERIFY(MiniUCD_ParseDigits(mixed, 2, &value) == 1);
+    PICOTEST_VERIFY(value == 1);
+    PICOTEST_VERIFY(MiniUCD_ParseDigits(ascii + 3, 1, &value) == 0);
+    PICOTEST_VERIFY(value == 0);
+    PICOTEST_VERIFY(MiniUCD_ParseDigits(big, 20, &value) == 20);
+    PICOTEST_VERIFY(value == UINT64_MAX);
+    PICOTEST_VERIFY(MiniUCD_ParseDigits(big, 21, &value) == 20);
+}
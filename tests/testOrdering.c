@@ -0,0 +1,59 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Canonical Ordering */
+PICOTEST_SUITE(testOrdering, testCanonicalOrderBasic,
+               testCanonicalOrderLongRun);
+
+PICOTEST_CASE(testCanonicalOrderBasic) {
+    uint32_t ordered[] = {'a', 0x0327, 0x0301, 'b', 0x0301};
+    uint32_t swapped[] = {'a', 0x0301, 0x0327, 'b'};
+    uint32_t stable[] = {'a', 0x0301, 0x0300, 0x0327, 0x1E0B, 0x0323};
+
+    PICOTEST_VERIFY(!MiniUCD_CanonicalOrder(ordered, 5));
+    PICOTEST_VERIFY(ordered[1] == 0x0327 && ordered[2] == 0x0301);
+
+    PICOTEST_VERIFY(MiniUCD_CanonicalOrder(swapped, 4));
+    PICOTEST_VERIFY(swapped[0] == 'a');
+    PICOTEST_VERIFY(swapped[1] == 0x0327 && swapped[2] == 0x0301);
+    PICOTEST_VERIFY(swapped[3] == 'b');
+
+    PICOTEST_VERIFY(MiniUCD_CanonicalOrder(stable, 6));
+    PICOTEST_VERIFY(stable[1] == 0x0327);
+    PICOTEST_VERIFY(stable[2] == 0x0301 && stable[3] == 0x0300);
+    PICOTEST_VERIFY(stable[4] == 0x1E0B && stable[5] == 0x0323);
+
+    PICOTEST_VERIFY(!MiniUCD_CanonicalOrder(stable, 0));
+}
+
+PICOTEST_CASE(testCanonicalOrderLongRun) {
+    /* Marks of classes 1, 202, 220 and 230 in reverse order. */
+    static const uint32_t marks[] = {0x0300, 0x0301, 0x0316, 0x0317,
+                                     0x0327, 0x0328, 0x0334, 0x0335};
+    uint32_t text[1001], expected[1001], c;
+    size_t i, j;
+
+    text[0] = 'a';
+    for (i = 1; i < 1001; i++) text[i] = marks[(7 * i) % 8];
+
+    /* Reference stable insertion sort. */
+    for (i = 0; i < 1001; i++) {
+        c = text[i];
+        for (j = i; j > 1 && MiniUCD_GetProperty_Ccc(expected[j - 1]) >
+                                 MiniUCD_GetProperty_Ccc(c);
+             j--) {
+            expected[j] = expected[j - 1];
+        }
+        expected[j] = c;
+    }
+
+    PICOTEST_VERIFY(MiniUCD_CanonicalOrder(text, 1001));
+    for (i = 0; i < 1001; i++) {
+        PICOTEST_VERIFY(text[i] == expected[i]);
+    }
+}
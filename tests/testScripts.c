@@ -0,0 +1,135 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Script Runs */
+PICOTEST_SUITE(testScripts, testScriptRun, testMixedScript);
+
+PICOTEST_SUITE(testScriptRun, testScriptRunBasic, testScriptRunExtensions,
+               testScriptRunBrackets, testScriptRunFeed);
+
+/* Expected runs are given as (end, script) pairs, terminated by -1. */
+static void checkScriptRuns(const wchar_t *text, ...) {
+    MiniUCD_ScriptRunIterator it;
+    MiniUCD_ScriptRun runs[64];
+    size_t nb = 0, i, start = 0;
+    va_list expected;
+
+    MiniUCD_ScriptRunInit(&it);
+    for (i = 0; text[i]; i++) {
+        nb += MiniUCD_ScriptRunPush(&it, text[i], runs + nb);
+    }
+    nb += MiniUCD_ScriptRunEnd(&it, runs + nb);
+
+    va_start(expected, text);
+    for (i = 0; i < nb; i++) {
+        PICOTEST_VERIFY(runs[i].start == start);
+        PICOTEST_VERIFY(va_arg(expected, int) == (int)runs[i].end);
+        PICOTEST_VERIFY(va_arg(expected, int) == (int)runs[i].script);
+        start = runs[i].end;
+    }
+    PICOTEST_VERIFY(va_arg(expected, int) == -1);
+    va_end(expected);
+}
+
+PICOTEST_CASE(testScriptRunBasic) {
+    checkScriptRuns(L"", -1);
+    checkScriptRuns(L"hello", 5, MINIUCD_SC_LATN, -1);
+    checkScriptRuns(L"123 ", 4, MINIUCD_SC_ZYYY, -1);
+    checkScriptRuns(L"abc \u03B1\u03B2\u03B3", 4, MINIUCD_SC_LATN, 7,
+                    MINIUCD_SC_GREK, -1);
+    checkScriptRuns(L"1. \u03B1", 4, MINIUCD_SC_GREK, -1);
+    checkScriptRuns(L"e\u0301\u03B1\u0301b", 2, MINIUCD_SC_LATN, 4,
+                    MINIUCD_SC_GREK, 5, MINIUCD_SC_LATN, -1);
+}
+PICOTEST_CASE(testScriptRunExtensions) {
+    /* ひらがなカタカナー漢字 */
+    checkScriptRuns(L"\u3072\u3089\u304C\u306A\u30AB\u30BF\u30AB\u30CA\u30FC\u6F22\u5B57",
+                    4, MINIUCD_SC_HIRA, 9, MINIUCD_SC_KANA, 11,
+                    MINIUCD_SC_HANI, -1);
+    checkScriptRuns(L"\u30FC", 1, MINIUCD_SC_HIRA, -1);
+    checkScriptRuns(L"\u30FC\u30AB", 2, MINIUCD_SC_KANA, -1);
+    checkScriptRuns(L"\u0915\u0964", 2, MINIUCD_SC_DEVA, -1); /* क। */
+    checkScriptRuns(L"a\u0964", 1, MINIUCD_SC_LATN, 2, MINIUCD_SC_BENG, -1);
+}
+PICOTEST_CASE(testScriptRunBrackets) {
+    checkScriptRuns(L"a(\u0431)c", 2, MINIUCD_SC_LATN, 3, MINIUCD_SC_CYRL, 5,
+                    MINIUCD_SC_LATN, -1);
+    checkScriptRuns(L"(\u0431)", 3, MINIUCD_SC_CYRL, -1);
+    checkScriptRuns(L"a[\u0431(b)]", 2, MINIUCD_SC_LATN, 4, MINIUCD_SC_CYRL, 5,
+                    MINIUCD_SC_LATN, 6, MINIUCD_SC_CYRL, 7, MINIUCD_SC_LATN,
+                    -1);
+    checkScriptRuns(L"a)\u0431", 2, MINIUCD_SC_LATN, 3, MINIUCD_SC_CYRL, -1);
+}
+PICOTEST_CASE(testScriptRunFeed) {
+    const uint32_t text[] = {'a', 'b', ' ', 0x03B1, 0x03B2, '.'};
+    MiniUCD_ScriptRunIterator it;
+    MiniUCD_ScriptRun runs[8];
+    size_t nb;
+
+    MiniUCD_ScriptRunInit(&it);
+    nb = MiniUCD_ScriptRunFeed(&it, text, 3, runs);
+    PICOTEST_ASSERT(nb == 0);
+    nb = MiniUCD_ScriptRunFeed(&it, text + 3, 3, runs);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(runs[0].start == 0);
+    PICOTEST_VERIFY(runs[0].end == 3);
+    PICOTEST_VERIFY(runs[0].script == MINIUCD_SC_LATN);
+    nb = MiniUCD_ScriptRunEnd(&it, runs);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(runs[0].start == 3);
+    PICOTEST_VERIFY(runs[0].end == 6);
+    PICOTEST_VERIFY(runs[0].script == MINIUCD_SC_GREK);
+}
+
+static int restrictionLevel(const wchar_t *text) {
+    uint32_t buffer[64];
+    size_t length;
+    for (length = 0; text[length]; length++) buffer[length] = text[length];
+    return MiniUCD_GetRestrictionLevel(buffer, length);
+}
+
+PICOTEST_SUITE(testMixedScript, testResolvedScriptSet, testRestrictionLevel);
+PICOTEST_CASE(testResolvedScriptSet) {
+    const uint32_t latin[] = {'a', '1', 0x0301};
+    const uint32_t mixed[] = {'a', 0x03B1};
+    const uint32_t japanese[] = {0x6F22, 0x304B, 0x30AB};
+    MiniUCD_ScriptSet set;
+
+    PICOTEST_VERIFY(MiniUCD_GetResolvedScriptSet(latin, 3, &set));
+    PICOTEST_VERIFY(set.bits[MINIUCD_SC_LATN / 32] &
+                    (1UL << (MINIUCD_SC_LATN % 32)));
+    PICOTEST_VERIFY(!(set.bits[MINIUCD_SC_GREK / 32] &
+                      (1UL << (MINIUCD_SC_GREK % 32))));
+    PICOTEST_VERIFY(!MiniUCD_GetResolvedScriptSet(mixed, 2, &set));
+    PICOTEST_VERIFY(MiniUCD_GetResolvedScriptSet(japanese, 3, &set));
+    PICOTEST_VERIFY(set.bits[MINIUCD_SCRIPTSET_JPAN / 32] &
+                    (1UL << (MINIUCD_SCRIPTSET_JPAN % 32)));
+}
+PICOTEST_CASE(testRestrictionLevel) {
+    PICOTEST_VERIFY(restrictionLevel(L"") == MINIUCD_RESTRICTION_ASCII_ONLY);
+    PICOTEST_VERIFY(restrictionLevel(L"user_42") ==
+                    MINIUCD_RESTRICTION_ASCII_ONLY);
+    PICOTEST_VERIFY(restrictionLevel(L"caf\u00E9") ==
+                    MINIUCD_RESTRICTION_SINGLE_SCRIPT);
+    PICOTEST_VERIFY(restrictionLevel(L"\u03B1\u03B2\u03B3") ==
+                    MINIUCD_RESTRICTION_SINGLE_SCRIPT);
+    PICOTEST_VERIFY(restrictionLevel(L"\u6F22\u5B57\u304B\u306A") ==
+                    MINIUCD_RESTRICTION_SINGLE_SCRIPT);
+    PICOTEST_VERIFY(restrictionLevel(L"abc\u6F22\u5B57") ==
+                    MINIUCD_RESTRICTION_HIGHLY_RESTRICTIVE);
+    PICOTEST_VERIFY(restrictionLevel(L"a\uAC00\u6F22") ==
+                    MINIUCD_RESTRICTION_HIGHLY_RESTRICTIVE);
+    PICOTEST_VERIFY(restrictionLevel(L"abc\u05D0") ==
+                    MINIUCD_RESTRICTION_MODERATELY_RESTRICTIVE);
+    PICOTEST_VERIFY(restrictionLevel(L"payp\u0430l") ==
+                    MINIUCD_RESTRICTION_MINIMALLY_RESTRICTIVE);
+    PICOTEST_VERIFY(restrictionLevel(L"\u05D0\u0627") ==
+                    MINIUCD_RESTRICTION_MINIMALLY_RESTRICTIVE);
+    PICOTEST_VERIFY(restrictionLevel(L"a\u16A0") ==
+                    MINIUCD_RESTRICTION_UNRESTRICTED);
+}
@@ -0,0 +1,83 @@
+#include <picotest.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Property Spans */
+PICOTEST_SUITE(testSpan, testInitSet, testSpanForward, testSpanBackward);
+
+static uint32_t ranges[2 * 1024];
+
+static size_t initPropertySet(MiniUCD_Set *set, MiniUCD_Property property,
+                              int value) {
+    size_t nb = MiniUCD_GetPropertyRanges(property, value, ranges, 1024);
+    MiniUCD_InitSet(set, ranges, nb);
+    return nb;
+}
+
+PICOTEST_CASE(testInitSet) {
+    static const uint32_t digits[] = {'0', '9', 0x0660, 0x0669};
+    MiniUCD_Set set;
+
+    MiniUCD_InitSet(&set, digits, 2);
+    PICOTEST_VERIFY(set.ascii[0] == 0x00000000);
+    PICOTEST_VERIFY(set.ascii[1] == 0x03FF0000);
+    PICOTEST_VERIFY(set.ascii[2] == 0 && set.ascii[3] == 0);
+    PICOTEST_VERIFY(set.ranges == digits && set.nbRanges == 2);
+
+    PICOTEST_ASSERT(initPropertySet(&set, MINIUCD_WSPACE, 1) <= 1024);
+    PICOTEST_VERIFY(set.ascii[0] == 0x00003E00);
+    PICOTEST_VERIFY(set.ascii[1] == 0x00000001);
+}
+
+PICOTEST_CASE(testSpanForward) {
+    /* "abc" ALPHA BETA "1" ARABIC-INDIC DIGIT ONE */
+    static const unsigned char text[] = "abc\xCE\xB1\xCE\xB2"
+                                        "1\xD9\xA1";
+    static const unsigned char invalid[] = "ab\xFF"
+                                           "c";
+    size_t length = sizeof(text) - 1;
+    MiniUCD_Set set;
+
+    PICOTEST_ASSERT(initPropertySet(&set, MINIUCD_ALPHA, 1) <= 1024);
+    PICOTEST_VERIFY(MiniUCD_Span(&set, text, length, 1) == 7);
+    PICOTEST_VERIFY(MiniUCD_Span(&set, text, length, 0) == 0);
+    PICOTEST_VERIFY(MiniUCD_Span(&set, text + 7, length - 7, 0) == 3);
+    PICOTEST_VERIFY(MiniUCD_Span(&set, text, 0, 1) == 0);
+
+    /* Truncated sequence. */
+    PICOTEST_VERIFY(MiniUCD_Span(&set, text, 4, 1) == 3);
+    PICOTEST_VERIFY(MiniUCD_Span(&set, text + 3, 1, 0) == 1);
+
+    /* Invalid bytes are not members. */
+    PICOTEST_VERIFY(MiniUCD_Span(&set, invalid, 4, 1) == 2);
+    PICOTEST_VERIFY(MiniUCD_Span(&set, invalid + 2, 2, 0) == 1);
+
+    PICOTEST_ASSERT(initPropertySet(&set, MINIUCD_GC, MINIUCD_GC_ND) <= 1024);
+    PICOTEST_VERIFY(MiniUCD_Span(&set, text, length, 0) == 7);
+    PICOTEST_VERIFY(MiniUCD_Span(&set, text + 7, length - 7, 1) == 3);
+}
+
+PICOTEST_CASE(testSpanBackward) {
+    /* "x" IDEOGRAPHIC SPACE "y" TAB IDEOGRAPHIC SPACE " " */
+    static const unsigned char text[] = "x\xE3\x80\x80y\t\xE3\x80\x80 ";
+    static const unsigned char invalid[] = " \x80 ";
+    size_t length = sizeof(text) - 1;
+    MiniUCD_Set set;
+
+    PICOTEST_ASSERT(initPropertySet(&set, MINIUCD_WSPACE, 1) <= 1024);
+    PICOTEST_VERIFY(MiniUCD_SpanBack(&set, text, length, 1) == 5);
+    PICOTEST_VERIFY(MiniUCD_SpanBack(&set, text, length, 0) == length);
+    PICOTEST_VERIFY(MiniUCD_SpanBack(&set, text, 5, 0) == 4);
+    PICOTEST_VERIFY(MiniUCD_SpanBack(&set, text, 4, 1) == 1);
+    PICOTEST_VERIFY(MiniUCD_SpanBack(&set, text, 1, 0) == 0);
+    PICOTEST_VERIFY(MiniUCD_SpanBack(&set, text, 0, 1) == 0);
+
+    /* Invalid bytes are not members. */
+    PICOTEST_VERIFY(MiniUCD_SpanBack(&set, invalid, 3, 1) == 2);
+    PICOTEST_VERIFY(MiniUCD_SpanBack(&set, invalid, 2, 0) == 1);
+}
@@ -0,0 +1,388 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Text Segmentation */
+PICOTEST_SUITE(testTextSegmentation, testGraphemeBreak, testWordBreak,
+               testSentenceBreak, testLineBreak, testSyllableBreak);
+
+/* Expected boundaries are given as a -1-terminated list. */
+static void checkGraphemeBreaks(const wchar_t *text, ...) {
+    MiniUCD_GraphemeBreakIterator it;
+    size_t boundaries[64], nb = 0, i;
+    va_list expected;
+
+    MiniUCD_GraphemeBreakInit(&it);
+    for (i = 0; text[i]; i++) {
+        nb += MiniUCD_GraphemeBreakPush(&it, text[i], boundaries + nb);
+    }
+    nb += MiniUCD_GraphemeBreakEnd(&it, boundaries + nb);
+
+    va_start(expected, text);
+    for (i = 0; i < nb; i++) {
+        PICOTEST_VERIFY(va_arg(expected, int) == (int)boundaries[i]);
+    }
+    PICOTEST_VERIFY(va_arg(expected, int) == -1);
+    va_end(expected);
+}
+
+/* Expected boundaries are given as a -1-terminated list. */
+static void checkWordBreaks(const wchar_t *text, ...) {
+    MiniUCD_WordBreakIterator it;
+    size_t boundaries[64], nb = 0, i;
+    va_list expected;
+
+    MiniUCD_WordBreakInit(&it);
+    for (i = 0; text[i]; i++) {
+        nb += MiniUCD_WordBreakPush(&it, text[i], boundaries + nb);
+    }
+    nb += MiniUCD_WordBreakEnd(&it, boundaries + nb);
+
+    va_start(expected, text);
+    for (i = 0; i < nb; i++) {
+        PICOTEST_VERIFY(va_arg(expected, int) == (int)boundaries[i]);
+    }
+    PICOTEST_VERIFY(va_arg(expected, int) == -1);
+    va_end(expected);
+}
+
+/* Expected boundaries are given as a -1-terminated list. */
+static void checkSentenceBreaks(const wchar_t *text, ...) {
+    MiniUCD_SentenceBreakIterator it;
+    size_t boundaries[64], nb = 0, i;
+    va_list expected;
+
+    MiniUCD_SentenceBreakInit(&it);
+    for (i = 0; text[i]; i++) {
+        nb += MiniUCD_SentenceBreakPush(&it, text[i], boundaries + nb);
+    }
+    nb += MiniUCD_SentenceBreakEnd(&it, boundaries + nb);
+
+    va_start(expected, text);
+    for (i = 0; i < nb; i++) {
+        PICOTEST_VERIFY(va_arg(expected, int) == (int)boundaries[i]);
+    }
+    PICOTEST_VERIFY(va_arg(expected, int) == -1);
+    va_end(expected);
+}
+
+/* Expected boundaries are given as a -1-terminated list. */
+static void checkSyllableBreaks(const wchar_t *text, ...) {
+    MiniUCD_SyllableBreakIterator it;
+    size_t boundaries[64], nb = 0, i;
+    va_list expected;
+
+    MiniUCD_SyllableBreakInit(&it);
+    for (i = 0; text[i]; i++) {
+        nb += MiniUCD_SyllableBreakPush(&it, text[i], boundaries + nb);
+    }
+    nb += MiniUCD_SyllableBreakEnd(&it, boundaries + nb);
+
+    va_start(expected, text);
+    for (i = 0; i < nb; i++) {
+        PICOTEST_VERIFY(va_arg(expected, int) == (int)boundaries[i]);
+    }
+    PICOTEST_VERIFY(va_arg(expected, int) == -1);
+    va_end(expected);
+}
+
+/* Mandatory line break in expected list. */
+#define HARD(i) (1000 + (i))
+
+/* Expected breaks are given as a -1-terminated list. */
+static void checkLineBreaks(const wchar_t *text, int options, ...) {
+    MiniUCD_LineBreakIterator it;
+    MiniUCD_LineBreak breaks[64];
+    size_t nb = 0, i;
+    va_list expected;
+
+    MiniUCD_LineBreakInit(&it, options);
+    for (i = 0; text[i]; i++) {
+        nb += MiniUCD_LineBreakPush(&it, text[i], breaks + nb);
+    }
+    nb += MiniUCD_LineBreakEnd(&it, breaks + nb);
+
+    va_start(expected, options);
+    for (i = 0; i < nb; i++) {
+        PICOTEST_VERIFY(va_arg(expected, int) ==
+                        (int)breaks[i].index + (breaks[i].mandatory ? 1000 : 0));
+    }
+    PICOTEST_VERIFY(va_arg(expected, int) == -1);
+    va_end(expected);
+}
+
+PICOTEST_SUITE(testGraphemeBreak, testGraphemeBreakBasic,
+               testGraphemeBreakEmoji, testGraphemeBreakIndic,
+               testGraphemeBreakFeed);
+PICOTEST_CASE(testGraphemeBreakBasic) {
+    checkGraphemeBreaks(L"", 0, -1);
+    checkGraphemeBreaks(L"ab", 0, 1, 2, -1);
+    checkGraphemeBreaks(L"a\r\nb", 0, 1, 3, 4, -1);           /* GB3 */
+    checkGraphemeBreaks(L"\n\u0301", 0, 1, 2, -1);            /* GB4 */
+    checkGraphemeBreaks(L"e\u0301x", 0, 2, 3, -1);             /* GB9 */
+    checkGraphemeBreaks(L"\u1100\u1161\u11A8\u1100", 0, 3, 4, -1); /* GB6-8 */
+    checkGraphemeBreaks(L"\u06001", 0, 2, -1);                 /* GB9b */
+}
+PICOTEST_CASE(testGraphemeBreakEmoji) {
+    checkGraphemeBreaks(L"\U0001F1EB\U0001F1F7\U0001F1EA", 0, 2, 3, -1); /* 🇫🇷 */
+    checkGraphemeBreaks(L"\U0001F468\u200D\U0001F469", 0, 3, -1); /* GB11 */
+    checkGraphemeBreaks(L"a\u200D\U0001F469", 0, 2, 3, -1);
+    checkGraphemeBreaks(L"\U0001F44D\U0001F3FD", 0, 2, -1);   /* 👍🏽 */
+}
+PICOTEST_CASE(testGraphemeBreakIndic) {
+    checkGraphemeBreaks(L"\u0915\u094D\u0937", 0, 3, -1);       /* GB9c */
+    checkGraphemeBreaks(L"\u0915\u094D\u200D\u0937", 0, 4, -1);
+    checkGraphemeBreaks(L"\u0915\u093F\u0937", 0, 2, 3, -1);
+}
+PICOTEST_CASE(testGraphemeBreakFeed) {
+    const uint32_t text[] = {'a', 0x0301, 0x0302, 'b', '\r', '\n'};
+    MiniUCD_GraphemeBreakIterator it;
+    size_t boundaries[16], nb;
+
+    MiniUCD_GraphemeBreakInit(&it);
+    nb = MiniUCD_GraphemeBreakFeed(&it, text, 2, boundaries);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(boundaries[0] == 0);
+    nb = MiniUCD_GraphemeBreakFeed(&it, text + 2, 4, boundaries);
+    PICOTEST_ASSERT(nb == 2);
+    PICOTEST_VERIFY(boundaries[0] == 3);
+    PICOTEST_VERIFY(boundaries[1] == 4);
+    nb = MiniUCD_GraphemeBreakEnd(&it, boundaries);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(boundaries[0] == 6);
+}
+
+PICOTEST_SUITE(testWordBreak, testWordBreakBasic, testWordBreakLookahead,
+               testWordBreakIgnorables, testWordBreakFeed);
+PICOTEST_CASE(testWordBreakBasic) {
+    checkWordBreaks(L"", 0, -1);
+    checkWordBreaks(L"a", 0, 1, -1);
+    checkWordBreaks(L"hello world", 0, 5, 6, 11, -1);
+    checkWordBreaks(L"a\r\nb", 0, 1, 3, 4, -1);
+    checkWordBreaks(L"a  b", 0, 1, 3, 4, -1);              /* WB3d */
+    checkWordBreaks(L"\u30A2\u30A4 ", 0, 2, 3, -1);        /* アイ */
+    checkWordBreaks(L"a_1", 0, 3, -1);                     /* WB13a/b */
+    checkWordBreaks(L"\U0001F1EB\U0001F1F7\U0001F1EA", 0, 2, 3, -1); /* 🇫🇷 */
+}
+PICOTEST_CASE(testWordBreakLookahead) {
+    checkWordBreaks(L"can't", 0, 5, -1);
+    checkWordBreaks(L"can'", 0, 3, 4, -1);
+    checkWordBreaks(L"can'.", 0, 3, 4, 5, -1);
+    checkWordBreaks(L"3.14", 0, 4, -1);
+    checkWordBreaks(L"3.a", 0, 1, 2, 3, -1);
+    checkWordBreaks(L"\u05D0\"\u05D1", 0, 3, -1); /* א"ב */
+    checkWordBreaks(L"\u05D0'", 0, 2, -1);         /* WB7a */
+}
+PICOTEST_CASE(testWordBreakIgnorables) {
+    checkWordBreaks(L"a\u0301'\u0301b", 0, 5, -1);
+    checkWordBreaks(L"\n\u0301", 0, 1, 2, -1);
+    checkWordBreaks(L"a\u200D\u2764", 0, 3, -1); /* WB3c */
+    checkWordBreaks(L"\u2764\u200D\u2764", 0, 3, -1);
+}
+PICOTEST_CASE(testWordBreakFeed) {
+    const uint32_t text[] = {'d', 'o', 'n', '\'', 't', ' ', 'g', 'o'};
+    MiniUCD_WordBreakIterator it, saved;
+    size_t boundaries[16], nb;
+
+    /* Split in the middle of a deferred boundary. */
+    MiniUCD_WordBreakInit(&it);
+    nb = MiniUCD_WordBreakFeed(&it, text, 4, boundaries);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(boundaries[0] == 0);
+    saved = it;
+    nb = MiniUCD_WordBreakFeed(&it, text + 4, 4, boundaries);
+    PICOTEST_ASSERT(nb == 2);
+    PICOTEST_VERIFY(boundaries[0] == 5);
+    PICOTEST_VERIFY(boundaries[1] == 6);
+    nb = MiniUCD_WordBreakEnd(&it, boundaries);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(boundaries[0] == 8);
+
+    /* Restart from saved position. */
+    nb = MiniUCD_WordBreakPush(&saved, ' ', boundaries);
+    PICOTEST_ASSERT(nb == 2);
+    PICOTEST_VERIFY(boundaries[0] == 3);
+    PICOTEST_VERIFY(boundaries[1] == 4);
+}
+
+PICOTEST_SUITE(testSentenceBreak, testSentenceBreakBasic,
+               testSentenceBreakLookahead, testSentenceBreakFeed);
+PICOTEST_CASE(testSentenceBreakBasic) {
+    checkSentenceBreaks(L"", 0, -1);
+    checkSentenceBreaks(L"Hello world. This is a test.", 0, 13, 28, -1);
+    checkSentenceBreaks(L"Wait! what?", 0, 6, 11, -1);
+    checkSentenceBreaks(L"He said \"Stop.\" Then left.", 0, 16, 26, -1);
+    checkSentenceBreaks(L"Pi is 3.14.", 0, 11, -1);      /* SB6 */
+    checkSentenceBreaks(L"U.S.A. It", 0, 7, 9, -1);      /* SB7 */
+    checkSentenceBreaks(L"No stop\r\nNext", 0, 9, 13, -1); /* SB3, SB4 */
+    checkSentenceBreaks(L"Ok.\u2029Go", 0, 4, 6, -1);    /* SB11 */
+}
+PICOTEST_CASE(testSentenceBreakLookahead) {
+    checkSentenceBreaks(L"etc. and more", 0, 13, -1);
+    checkSentenceBreaks(L"etc. 123 and more", 0, 17, -1);
+    checkSentenceBreaks(L"etc. 123 More", 0, 5, 13, -1);
+    checkSentenceBreaks(L"See p. (12) \"34\" x", 0, 18, -1);
+    checkSentenceBreaks(L"End. 12", 0, 5, 7, -1);
+    checkSentenceBreaks(L"End.) 12\n", 0, 6, 9, -1);
+    checkSentenceBreaks(L"Yes., no", 0, 8, -1);          /* SB8a */
+}
+PICOTEST_CASE(testSentenceBreakFeed) {
+    const uint32_t text[] = {'A', '.', ' ', '1', ' ', '2', ' ', 'B'};
+    MiniUCD_SentenceBreakIterator it;
+    size_t boundaries[16], nb;
+    int i;
+
+    /* Deferred boundary spans several feeds. */
+    MiniUCD_SentenceBreakInit(&it);
+    for (i = 0; i < 7; i++) {
+        nb = MiniUCD_SentenceBreakFeed(&it, text + i, 1, boundaries);
+        PICOTEST_ASSERT(nb == (i == 0 ? 1 : 0));
+    }
+    nb = MiniUCD_SentenceBreakFeed(&it, text + 7, 1, boundaries);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(boundaries[0] == 3);
+    nb = MiniUCD_SentenceBreakEnd(&it, boundaries);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(boundaries[0] == 8);
+}
+
+PICOTEST_SUITE(testLineBreak, testLineBreakBasic, testLineBreakLookahead,
+               testLineBreakEastAsian, testLineBreakIncremental);
+PICOTEST_CASE(testLineBreakBasic) {
+    checkLineBreaks(L"", 0, -1);
+    checkLineBreaks(L"Hello world", 0, 6, HARD(11), -1);
+    checkLineBreaks(L"a\nb\r\nc", 0, HARD(2), HARD(5), HARD(6), -1);
+    checkLineBreaks(L"(foo) bar", 0, 6, HARD(9), -1);
+    checkLineBreaks(L"$1,000.00 x", 0, 10, HARD(11), -1); /* LB25 */
+    checkLineBreaks(L"well-known -x", 0, 5, 11, HARD(13), -1); /* LB20a */
+    checkLineBreaks(L"a\u0301 b", 0, 3, HARD(4), -1);       /* LB9 */
+    checkLineBreaks(L"a\u200Bb", 0, 2, HARD(3), -1);        /* LB8 */
+    checkLineBreaks(L"\U0001F1E6\U0001F1E8\U0001F1E6", 0, 2, HARD(3), -1); /* LB30a */
+    checkLineBreaks(L"\U0001F44D\U0001F3FB \U0001F468\u200D\U0001F469", 0, 3,
+                    HARD(6), -1); /* LB8a, LB30b */
+}
+PICOTEST_CASE(testLineBreakLookahead) {
+    checkLineBreaks(L"x .5", 0, 2, HARD(4), -1);          /* LB15c */
+    checkLineBreaks(L"x .a", 0, HARD(4), -1);             /* LB15d */
+    checkLineBreaks(L"a \u201Cb\u201D c", 0, 2, 6, HARD(7), -1); /* LB15a */
+    checkLineBreaks(L"a \u201D b", 0, 4, HARD(5), -1);         /* LB15b */
+    checkLineBreaks(L"a \u201Db", 0, 2, HARD(4), -1);
+    checkLineBreaks(L"$(1)", 0, HARD(4), -1);             /* LB25 */
+    checkLineBreaks(L"$(a)", 0, 1, HARD(4), -1);
+    checkLineBreaks(L"$(.5", 0, HARD(4), -1);
+    checkLineBreaks(L"$(.a", 0, 1, HARD(4), -1);
+    checkLineBreaks(L"$-.5", 0, HARD(4), -1);
+}
+PICOTEST_CASE(testLineBreakEastAsian) {
+    checkLineBreaks(L"\u6F22\u5B57\u3002\u304B\u306A", 0, 1, 3, 4, HARD(5), -1);
+    checkLineBreaks(L"\u6F22\u300C\u5B57\u300D", 0, 1, HARD(4), -1);
+    checkLineBreaks(L"\u00A7\u00A7", 0, HARD(2), -1);             /* LB1 AI */
+    checkLineBreaks(L"\u00A7\u00A7", MINIUCD_LINEBREAK_AMBIGUOUS_WIDE, 1, HARD(2), -1);
+    checkLineBreaks(L"\u3041\u3041", 0, HARD(2), -1);             /* LB1 CJ */
+    checkLineBreaks(L"\u3041\u3041", MINIUCD_LINEBREAK_CJ_AS_ID, 1, HARD(2), -1);
+    checkLineBreaks(L"a(b", 0, HARD(3), -1);                   /* LB30 */
+    checkLineBreaks(L"a\uFF08b", 0, 1, HARD(3), -1);
+}
+PICOTEST_CASE(testLineBreakIncremental) {
+    const uint32_t before[] = {'a', 'a', ' ', 'b', 'b', ' ', 'c', 'c'};
+    const uint32_t after[] = {'a', 'a', ' ', 'b', ' ', 'x', 'b', ' ', 'c', 'c'};
+    MiniUCD_LineBreakIterator saved[8], it;
+    MiniUCD_LineBreak breaks[4];
+    size_t i, nb = 0;
+
+    /* Save state after each codepoint. */
+    MiniUCD_LineBreakInit(&it, 0);
+    for (i = 0; i < 8; i++) {
+        MiniUCD_LineBreakPush(&it, before[i], breaks);
+        saved[i] = it;
+    }
+
+    /* Insert " x" at index 4: re-wrap from the state before the edit, until
+     * the state past the edit matches the old one. */
+    it = saved[2];
+    for (i = 3; i < 10; i++) {
+        nb += MiniUCD_LineBreakPush(&it, after[i], breaks + nb);
+        if (i >= 6 && MiniUCD_LineBreakSameState(&it, &saved[i - 2])) break;
+    }
+    PICOTEST_VERIFY(i == 6);
+    PICOTEST_ASSERT(nb == 2);
+    PICOTEST_VERIFY(breaks[0].index == 3 && !breaks[0].mandatory);
+    PICOTEST_VERIFY(breaks[1].index == 5 && !breaks[1].mandatory);
+}
+
+PICOTEST_SUITE(testSyllableBreak, testSyllableBreakBasic,
+               testSyllableBreakConjuncts, testSyllableBreakClusters,
+               testSyllableBreakFeed);
+PICOTEST_CASE(testSyllableBreakBasic) {
+    checkSyllableBreaks(L"", 0, -1);
+    checkSyllableBreaks(L"ab\r\n", 0, 1, 2, 4, -1);
+    checkSyllableBreaks(L"e\u0301x", 0, 2, 3, -1);
+    checkSyllableBreaks(L"\u0915\u093F\u0937", 0, 2, 3, -1);      /* कि ष */
+    checkSyllableBreaks(L"\u0905\u0902\u0915", 0, 2, 3, -1);      /* अं क */
+    checkSyllableBreaks(L"\u25CC\u093F", 0, 2, -1);              /* ◌ि */
+    checkSyllableBreaks(L"\u0301a", 0, 1, 2, -1);
+    checkSyllableBreaks(L"\u200C", 0, 1, -1);
+    checkSyllableBreaks(L"\u0E01\u0E40\u0E01", 0, 1, 3, -1);      /* กเก */
+    checkSyllableBreaks(L"\u0EC0\u0E81\u0EC0", 0, 2, 3, -1);      /* ເກເ */
+}
+PICOTEST_CASE(testSyllableBreakConjuncts) {
+    checkSyllableBreaks(L"\u0915\u094D\u0937", 0, 3, -1);         /* क्ष */
+    checkSyllableBreaks(L"\u0915\u094D\u200D\u0937", 0, 4, -1);
+    checkSyllableBreaks(L"\u0915\u094D\u200C\u0937", 0, 3, 4, -1); /* ZWNJ */
+    checkSyllableBreaks(L"\u0B95\u0BCD\u0B95", 0, 2, 3, -1);      /* Tamil */
+    checkSyllableBreaks(L"\u0D4E\u0D15\u0D3E", 0, 3, -1);         /* Dot reph */
+    checkSyllableBreaks(L"\u0915\u094D\u0B95", 0, 2, 3, -1);      /* क्க */
+}
+PICOTEST_CASE(testSyllableBreakClusters) {
+    /* Syllable boundaries are grapheme cluster boundaries. */
+    static const uint32_t pool[] = {
+        'a', '\r', '\n', 0x0301, 0x200C, 0x200D, 0x0915, 0x093F, 0x094D,
+        0x0903, 0x0B95, 0x0BCD, 0x0D4E, 0x0E01, 0x0E40, 0x0600, 0x1100,
+        0x1F1E6, 0x1F600,
+    };
+    const size_t nbPool = sizeof(pool) / sizeof(*pool);
+    size_t i, j, n, nbS, nbG;
+
+    for (n = 0; n < nbPool * nbPool * nbPool; n++) {
+        uint32_t text[3];
+        size_t syllables[4], graphemes[4];
+        MiniUCD_SyllableBreakIterator it;
+        MiniUCD_GraphemeBreakIterator git;
+
+        text[0] = pool[n % nbPool];
+        text[1] = pool[n / nbPool % nbPool];
+        text[2] = pool[n / nbPool / nbPool];
+        MiniUCD_SyllableBreakInit(&it);
+        nbS = MiniUCD_SyllableBreakFeed(&it, text, 3, syllables);
+        nbS += MiniUCD_SyllableBreakEnd(&it, syllables + nbS);
+        MiniUCD_GraphemeBreakInit(&git);
+        nbG = MiniUCD_GraphemeBreakFeed(&git, text, 3, graphemes);
+        nbG += MiniUCD_GraphemeBreakEnd(&git, graphemes + nbG);
+        PICOTEST_ASSERT(nbS >= 2 && syllables[0] == 0 && syllables[nbS-1] == 3);
+        for (i = 0; i < nbS; i++) {
+            for (j = 0; j < nbG && graphemes[j] != syllables[i]; j++);
+            PICOTEST_ASSERT(j < nbG);
+        }
+    }
+}
+PICOTEST_CASE(testSyllableBreakFeed) {
+    const uint32_t text[] = {0x0915, 0x094D, 0x0937, 0x093F, 0x0915, 'a'};
+    MiniUCD_SyllableBreakIterator it;
+    size_t boundaries[16], nb;
+
+    MiniUCD_SyllableBreakInit(&it);
+    nb = MiniUCD_SyllableBreakFeed(&it, text, 2, boundaries);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(boundaries[0] == 0);
+    nb = MiniUCD_SyllableBreakFeed(&it, text + 2, 4, boundaries);
+    PICOTEST_ASSERT(nb == 2);
+    PICOTEST_VERIFY(boundaries[0] == 4);
+    PICOTEST_VERIFY(boundaries[1] == 5);
+    nb = MiniUCD_SyllableBreakEnd(&it, boundaries);
+    PICOTEST_ASSERT(nb == 1);
+    PICOTEST_VERIFY(boundaries[0] == 6);
+}
@@ -0,0 +1,98 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* UTF-8 Automata */
+PICOTEST_SUITE(testUtf8Automata, testCompileUtf8Automaton,
+               testMatchUtf8Automaton);
+
+PICOTEST_CASE(testCompileUtf8Automaton) {
+    static const uint32_t all[] = {0, 0x10FFFF};
+    static const uint32_t letters[] = {'A', 'Z', 'a', 'z'};
+    static const uint32_t greek[] = {0x0391, 0x03A9};
+    static const uint32_t surrogates[] = {0xD800, 0xDFFF};
+    MiniUCD_Utf8Transition automaton[32];
+    const size_t size = sizeof(automaton) / sizeof(*automaton);
+    size_t nb;
+
+    /* Whole codepoint space; sizing gives an upper bound. */
+    nb = MiniUCD_CompileUtf8Automaton(all, 1, NULL, 0);
+    PICOTEST_ASSERT(nb >= 16 && nb <= size);
+    PICOTEST_ASSERT(MiniUCD_CompileUtf8Automaton(all, 1, automaton, size)
+                    == 16);
+    PICOTEST_VERIFY(automaton[0].first == 0x00 && automaton[0].last == 0x7F);
+    PICOTEST_VERIFY(automaton[0].next == MINIUCD_UTF8_ACCEPT);
+    PICOTEST_VERIFY(automaton[1].first == 0xC2 && automaton[1].last == 0xDF);
+    PICOTEST_VERIFY(automaton[8].first == 0xF4 && automaton[8].last == 0xF4);
+    PICOTEST_VERIFY(automaton[8].end);
+
+    /* Trailing bytes of E1..EC and EE..EF sequences share the same state. */
+    PICOTEST_VERIFY(automaton[3].first == 0xE1 && automaton[3].last == 0xEC);
+    PICOTEST_VERIFY(automaton[5].first == 0xEE && automaton[5].last == 0xEF);
+    PICOTEST_VERIFY(automaton[3].next == automaton[5].next);
+
+    /* Single state. */
+    PICOTEST_ASSERT(MiniUCD_CompileUtf8Automaton(letters, 2, automaton, size)
+                    == 2);
+    PICOTEST_VERIFY(automaton[0].first == 'A' && automaton[0].last == 'Z');
+    PICOTEST_VERIFY(automaton[1].first == 'a' && automaton[1].last == 'z');
+    PICOTEST_VERIFY(!automaton[0].end && automaton[1].end);
+
+    /* Two states. */
+    PICOTEST_ASSERT(MiniUCD_CompileUtf8Automaton(greek, 1, automaton, size)
+                    == 2);
+    PICOTEST_VERIFY(automaton[0].first == 0xCE && automaton[0].last == 0xCE);
+    PICOTEST_VERIFY(automaton[0].end && automaton[0].next == 1);
+    PICOTEST_VERIFY(automaton[1].first == 0x91 && automaton[1].last == 0xA9);
+    PICOTEST_VERIFY(automaton[1].next == MINIUCD_UTF8_ACCEPT);
+
+    /* Empty sets. */
+    PICOTEST_ASSERT(MiniUCD_CompileUtf8Automaton(surrogates, 1, automaton, size)
+                    == 1);
+    PICOTEST_VERIFY(automaton[0].first > automaton[0].last);
+    PICOTEST_VERIFY(MiniUCD_CompileUtf8Automaton(NULL, 0, automaton, size) == 1);
+}
+
+PICOTEST_CASE(testMatchUtf8Automaton) {
+    static uint32_t ranges[2 * 1024];
+    static MiniUCD_Utf8Transition automaton[2048];
+    MiniUCD_Property property = MiniUCD_LookupProperty("gc", 2);
+    int value = MiniUCD_LookupPropertyValue(property, "L", 1);
+    size_t nbRanges, nb;
+
+    nbRanges = MiniUCD_GetPropertyRanges(property, value, ranges, 1024);
+    PICOTEST_ASSERT(nbRanges <= 1024);
+    nb = MiniUCD_CompileUtf8Automaton(ranges, nbRanges, NULL, 0);
+    PICOTEST_ASSERT(nb <= 2048);
+    nb = MiniUCD_CompileUtf8Automaton(ranges, nbRanges, automaton, nb);
+
+    /* Letters. */
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "Ab", 2) == 1);
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "\xCE\xB1", 2) == 2);
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "\xE4\xB8\x80", 3) == 3);
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "\xF0\x9D\x90\x80", 4) == 4);
+
+    /* Non-letters. */
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "1", 1) == 0);
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "\xE2\x82\xAC", 3) == 0);
+
+    /* Ill-formed or truncated sequences. */
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "\xC1\x81", 2) == 0);
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "\xB1", 1) == 0);
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "\xCE", 1) == 0);
+    PICOTEST_VERIFY(MiniUCD_MatchUtf8Automaton(automaton,
+                    (const unsigned char *) "", 0) == 0);
+}
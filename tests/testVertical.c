@@ -0,0 +1,47 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Vertical Orientation */
+PICOTEST_SUITE(testVertical, testVerticalRun);
+
+/* Expected runs are given as a -1-terminated list of (end, orientation). */
+static void checkVerticalRuns(const wchar_t *text, ...) {
+    MiniUCD_VerticalRunIterator it;
+    MiniUCD_VerticalRun runs[64];
+    size_t nb, i, start = 0;
+    va_list expected;
+
+    MiniUCD_VerticalRunInit(&it);
+    for (i = 0, nb = 0; text[i]; i++) {
+        nb += MiniUCD_VerticalRunPush(&it, text[i], runs + nb);
+    }
+    nb += MiniUCD_VerticalRunEnd(&it, runs + nb);
+
+    va_start(expected, text);
+    for (i = 0; i < nb; i++) {
+        PICOTEST_VERIFY(runs[i].start == start);
+        PICOTEST_VERIFY(va_arg(expected, int) == (int)runs[i].end);
+        PICOTEST_VERIFY(va_arg(expected, int) == (int)runs[i].orientation);
+        start = runs[i].end;
+    }
+    PICOTEST_VERIFY(va_arg(expected, int) == -1);
+    va_end(expected);
+}
+
+#define U MINIUCD_VO_U
+#define R MINIUCD_VO_R
+#define TU MINIUCD_VO_TU
+
+PICOTEST_CASE(testVerticalRun) {
+    checkVerticalRuns(L"", -1);
+    checkVerticalRuns(L"\u6F22\u5B57abc", 2, U, 5, R, -1);
+    checkVerticalRuns(L"\u6F22\u3001\u5B57", 1, U, 2, TU, 3, U, -1); /* 漢、字 */
+    checkVerticalRuns(L"\u6F22a\u0301\u5B57", 1, U, 3, R, 4, U, -1);
+    checkVerticalRuns(L"\u304B\u3099\u304B", 3, U, -1);              /* が */
+    checkVerticalRuns(L"a1\u20DDb", 1, R, 3, U, 4, R, -1);          /* 1⃝ */
+}
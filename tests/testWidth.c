@@ -0,0 +1,54 @@
+#include <picotest.h>
+#include <stdint.h>
+
+#define MiniUCD_Char uint32_t
+#include <miniucd.h>
+
+#include "hooks.h"
+
+/* Display Width */
+PICOTEST_SUITE(testWidth, testCharWidth, testStringWidth);
+
+static size_t stringWidth(const wchar_t *text, int ambiguousWidth) {
+    uint32_t buffer[64];
+    size_t length;
+    for (length = 0; text[length]; length++) buffer[length] = text[length];
+    return MiniUCD_StringWidth(buffer, length, ambiguousWidth);
+}
+
+PICOTEST_CASE(testCharWidth) {
+    PICOTEST_VERIFY(MiniUCD_CharWidth('a', 1) == 1);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x0000, 1) == 0);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x001B, 1) == 0);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x00AD, 1) == 1); /* SOFT HYPHEN */
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x0301, 1) == 0);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x200B, 1) == 0);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x1100, 1) == 2);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x1161, 1) == 0);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x4E00, 1) == 2);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0xFF21, 1) == 2);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0xFF61, 1) == 1);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x1F600, 1) == 2);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x3FFFD, 1) == 2);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x110000, 1) == 1);
+
+    /* Ambiguous. */
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x00B1, 1) == 1);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0x00B1, 2) == 2);
+    PICOTEST_VERIFY(MiniUCD_CharWidth(0xE000, 2) == 2);
+}
+
+PICOTEST_CASE(testStringWidth) {
+    PICOTEST_VERIFY(stringWidth(L"", 1) == 0);
+    PICOTEST_VERIFY(stringWidth(L"hello", 1) == 5);
+    PICOTEST_VERIFY(stringWidth(L"\u65E5\u672C\u8A9E", 1) == 6); /* 日本語 */
+    PICOTEST_VERIFY(stringWidth(L"e\u0301", 1) == 1);
+    PICOTEST_VERIFY(stringWidth(L"\u1100\u1161\u11A8", 1) == 2);
+    PICOTEST_VERIFY(stringWidth(L"\U0001F1EB\U0001F1F7", 1) == 2); /* 🇫🇷 */
+    PICOTEST_VERIFY(stringWidth(L"\U0001F468\u200D\U0001F469", 1) == 2);
+    PICOTEST_VERIFY(stringWidth(L"\u2764", 1) == 1);
+    PICOTEST_VERIFY(stringWidth(L"\u2764\uFE0F", 1) == 2);
+    PICOTEST_VERIFY(stringWidth(L"a\uFE0F", 1) == 1);
+    PICOTEST_VERIFY(stringWidth(L"\u00B1\u00B1", 1) == 2);
+    PICOTEST_VERIFY(stringWidth(L"\u00B1\u00B1", 2) == 4);
+}
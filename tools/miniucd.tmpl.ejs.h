@@ -264,223 +264,1418 @@ typedef enum MiniUCD_<%- Property %> {<%
 /* End of UCD Property Accessors *//*!\}*/
 
 
-#ifdef MINIUCD_IMPLEMENTATION
-#include <limits.h>
+/***************************************************************************//*!
+ * \defgroup segmentation Text Segmentation
+ *
+ * Streaming text segmentation iterators.
+ *
+ * Iterators are fed one codepoint at a time and report boundaries as
+ * codepoint indices from the start of the stream, as soon as they are known.
+ * Segmentation rules are compiled into state machines by the generator, so
+ * each codepoint costs one class lookup and one table lookup. Iterator
+ * structures are plain values, they need no cleanup and can be copied to
+ * save or restore a position.
+ ***************************************************************************\{*/
 
-/*
- * Prototypes for functions used only in this file.
+/**
+ * Range lookup cursor.
+ *
+ * Remembers the last range found during lookup, so that runs of codepoints
+ * sharing the same value (the common case in running text) don't need a new
+ * binary search.
  */
+typedef struct MiniUCD_RangeCursor {
+    MiniUCD_Char first; /*!< First codepoint of cached range. */
+    MiniUCD_Char last;  /*!< Last codepoint of cached range. */
+    int index;          /*!< Index of cached range. */
+} MiniUCD_RangeCursor;
 
-/*! \cond IGNORE */
-static int              miniucdGetRange(MiniUCD_Char c, 
-                            const MiniUCD_Char *ranges, int nbRanges);
-/*! \endcond *//* IGNORE */
+/**
+ * Grapheme cluster boundary iterator, implementing UAX #29 extended grapheme
+ * cluster boundary rules.
+ *
+ * Grapheme cluster boundaries only depend on the codepoints before them, so
+ * they are reported as soon as the codepoint after them is known.
+ *
+ * @see MiniUCD_GraphemeBreakInit
+ * @see MiniUCD_GraphemeBreakPush
+ * @see MiniUCD_GraphemeBreakFeed
+ * @see MiniUCD_GraphemeBreakEnd
+ * @see http://unicode.org/reports/tr29/#Grapheme_Cluster_Boundaries
+ */
+typedef struct MiniUCD_GraphemeBreakIterator {
+    int state;                  /*!< State machine state. */
+    size_t index;               /*!< Index of next codepoint. */
+    MiniUCD_RangeCursor cursor; /*!< Class lookup cursor. */
+} MiniUCD_GraphemeBreakIterator;
 
+MINIUCD_DEF void        MiniUCD_GraphemeBreakInit(
+                            MiniUCD_GraphemeBreakIterator *it);
+MINIUCD_DEF int         MiniUCD_GraphemeBreakPush(
+                            MiniUCD_GraphemeBreakIterator *it, MiniUCD_Char c,
+                            size_t *boundaries);
+MINIUCD_DEF size_t      MiniUCD_GraphemeBreakFeed(
+                            MiniUCD_GraphemeBreakIterator *it,
+                            const MiniUCD_Char *text, size_t length,
+                            size_t *boundaries);
+MINIUCD_DEF int         MiniUCD_GraphemeBreakEnd(
+                            MiniUCD_GraphemeBreakIterator *it,
+                            size_t *boundaries);
 
-/*
-===========================================================================*//*!
-\internal \defgroup ucd_data Compiled UCD Data
+/**
+ * Word boundary iterator, implementing UAX #29 word boundary rules.
+ *
+ * Boundaries that depend on the codepoints that follow (WB6, WB7b, WB12) are
+ * deferred until the next codepoint that is not ignored by rule WB4, so
+ * memory usage is bounded regardless of the input.
+ *
+ * @see MiniUCD_WordBreakInit
+ * @see MiniUCD_WordBreakPush
+ * @see MiniUCD_WordBreakFeed
+ * @see MiniUCD_WordBreakEnd
+ * @see http://unicode.org/reports/tr29/#Word_Boundaries
+ */
+typedef struct MiniUCD_WordBreakIterator {
+    int state;                  /*!< State machine state. */
+    size_t index;               /*!< Index of next codepoint. */
+    size_t deferred;            /*!< Index of deferred boundary, if any. */
+    MiniUCD_RangeCursor cursor; /*!< Class lookup cursor. */
+} MiniUCD_WordBreakIterator;
 
-Statically compiled Unicode Character Database (UCD).
+MINIUCD_DEF void        MiniUCD_WordBreakInit(MiniUCD_WordBreakIterator *it);
+MINIUCD_DEF int         MiniUCD_WordBreakPush(MiniUCD_WordBreakIterator *it,
+                            MiniUCD_Char c, size_t *boundaries);
+MINIUCD_DEF size_t      MiniUCD_WordBreakFeed(MiniUCD_WordBreakIterator *it,
+                            const MiniUCD_Char *text, size_t length,
+                            size_t *boundaries);
+MINIUCD_DEF int         MiniUCD_WordBreakEnd(MiniUCD_WordBreakIterator *it,
+                            size_t *boundaries);
 
-The Unicode Character Database (UCD) defines a set of properties for every known
-codepoint in the standard. This represents a huge quantity of raw data for over
-one million codepoints. Storing this data as flat C arrays of high level
-structures is not realistic, as it would inflate the size of the compiled binary
-by tens of megabytes and would overburden the client processes' memory.
+/**
+ * Sentence boundary iterator, implementing UAX #29 sentence boundary rules.
+ *
+ * The boundary after a full stop followed by closing punctuation and spaces
+ * depends on whether a lowercase letter follows before any other letter or
+ * sentence terminator (SB8). This boundary is deferred until that question is
+ * settled, however far ahead, so memory usage is bounded regardless of the
+ * input.
+ *
+ * @see MiniUCD_SentenceBreakInit
+ * @see MiniUCD_SentenceBreakPush
+ * @see MiniUCD_SentenceBreakFeed
+ * @see MiniUCD_SentenceBreakEnd
+ * @see http://unicode.org/reports/tr29/#Sentence_Boundaries
+ */
+typedef struct MiniUCD_SentenceBreakIterator {
+    int state;                  /*!< State machine state. */
+    size_t index;               /*!< Index of next codepoint. */
+    size_t deferred;            /*!< Index of deferred boundary, if any. */
+    MiniUCD_RangeCursor cursor; /*!< Class lookup cursor. */
+} MiniUCD_SentenceBreakIterator;
 
-To solve this problem we compile the UCD in the most compact way possible using
-a combination of techniques:
+MINIUCD_DEF void        MiniUCD_SentenceBreakInit(
+                            MiniUCD_SentenceBreakIterator *it);
+MINIUCD_DEF int         MiniUCD_SentenceBreakPush(
+                            MiniUCD_SentenceBreakIterator *it, MiniUCD_Char c,
+                            size_t *boundaries);
+MINIUCD_DEF size_t      MiniUCD_SentenceBreakFeed(
+                            MiniUCD_SentenceBreakIterator *it,
+                            const MiniUCD_Char *text, size_t length,
+                            size_t *boundaries);
+MINIUCD_DEF int         MiniUCD_SentenceBreakEnd(
+                            MiniUCD_SentenceBreakIterator *it,
+                            size_t *boundaries);
 
-- Don't store flat arrays of values, but contiguous ranges of values that are
-  binary-searched during lookup; as neighboring codepoints in the UCD often
-  share the same properties, this technique is very efficient.
-- Use enums for all enumerated properties to minimize storage (values fit a
-  single byte in most cases).
-- Boolean properties need only the first value since consecutive ranges have
-  alternate values.
-- Use atom tables for strings and complex datatypes to reuse storage.
+/**
+ * Line breaking options.
+ *
+ * @see MiniUCD_LineBreakInit
+ */
+#define MINIUCD_LINEBREAK_AMBIGUOUS_WIDE    0x01 /*!< Resolve AI class as ID
+                                                  *   (East Asian context). */
+#define MINIUCD_LINEBREAK_CJ_AS_ID          0x02 /*!< Resolve CJ class as ID
+                                                  *   (normal and loose line
+                                                  *   breaking). */
 
-That way, all but the name properties are statically defined in the library
-without too much overhead. By comparison the uncompressed textual version of the
-UCD weighs around 15MB, and the grouped XML version around 40MB.
-\{*//*==========================================================================
-*/
+/**
+ * Line break opportunity.
+ *
+ * @see MiniUCD_LineBreakIterator
+ */
+typedef struct MiniUCD_LineBreak {
+    size_t index;  /*!< Index of the codepoint after the break. */
+    int mandatory; /*!< Whether the break is mandatory (hard line break). */
+} MiniUCD_LineBreak;
 
-/** @beginprivate @cond PRIVATE */
+/**
+ * Line breaking iterator, implementing UAX #14 line breaking rules.
+ *
+ * Rules are compiled into a pair table: rows are left contexts (the class of
+ * the last codepoint plus the few bits of history needed by contextual rules
+ * such as LB15a, LB21a, LB25 or LB30a), columns are classes of the next
+ * codepoint. Classes merge Line_Break with the East_Asian_Width information
+ * needed by LB19a, LB21a and LB30, and ASCII characters get a direct class
+ * lookup. Break opportunities that depend on the codepoint that follows
+ * (LB15b, LB15c, LB19a, LB25, LB28a) are deferred until that codepoint is
+ * known.
+ *
+ * Line breaking only depends on the current iterator state, so re-wrapping
+ * after an edit doesn't need to rescan the whole paragraph: restart from a
+ * copy of the iterator saved before the edit, and stop as soon as the
+ * iterator gets back to a saved state past the edit (see
+ * MiniUCD_LineBreakSameState()); all further breaks are the same as before,
+ * shifted by the edit length.
+ *
+ * @see MiniUCD_LineBreakInit
+ * @see MiniUCD_LineBreakPush
+ * @see MiniUCD_LineBreakFeed
+ * @see MiniUCD_LineBreakEnd
+ * @see MiniUCD_LineBreakSameState
+ * @see http://unicode.org/reports/tr14/
+ */
+typedef struct MiniUCD_LineBreakIterator {
+    int state;                  /*!< State machine state. */
+    int options;                /*!< Line breaking options. */
+    size_t index;               /*!< Index of next codepoint. */
+    size_t deferred;            /*!< Index of deferred break, if any. */
+    MiniUCD_RangeCursor cursor; /*!< Class lookup cursor. */
+} MiniUCD_LineBreakIterator;
 
-<%
-  // At this point we have per-property ranges of values, now output C file.
-  // For each property we output two C arrays:
-  //
-  //  - First one is used for indexing; it gives the first codepoint in a
-  //    contiguous range of values (omitting the first entry which is always zero).
-  //    This array is binary-searched during lookup until we find the range
-  //    containing a given codepoint.
-  //  - Second one is used for values. The index computed during lookup in the
-  //    first array gives the index in this second array (1 is added for the
-  //    missing first entry).
-  //  - If the value type is enumerated, values are directly stored in the second
-  //    array. Otherwise, the latter stores an index to a third array containing
-  //    the set of unique values. This can be a C string or the first element in
-  //    a list (usually zero-terminated, depending on the type).
-  //
-  // The code always chooses the shortest integral type for indices & value storage
-  // (e.g. char for values < 256).
+MINIUCD_DEF void        MiniUCD_LineBreakInit(MiniUCD_LineBreakIterator *it,
+                            int options);
+MINIUCD_DEF int         MiniUCD_LineBreakPush(MiniUCD_LineBreakIterator *it,
+                            MiniUCD_Char c, MiniUCD_LineBreak *breaks);
+MINIUCD_DEF size_t      MiniUCD_LineBreakFeed(MiniUCD_LineBreakIterator *it,
+                            const MiniUCD_Char *text, size_t length,
+                            MiniUCD_LineBreak *breaks);
+MINIUCD_DEF int         MiniUCD_LineBreakEnd(MiniUCD_LineBreakIterator *it,
+                            MiniUCD_LineBreak *breaks);
+MINIUCD_DEF int         MiniUCD_LineBreakSameState(
+                            const MiniUCD_LineBreakIterator *it1,
+                            const MiniUCD_LineBreakIterator *it2);
 
-  for (const [property, info] of Object.entries(properties)) {
-    if (["deprecated", "name"].includes(info.type)) continue;
+/**
+ * Indic syllable boundary iterator.
+ *
+ * Syllables (orthographic clusters) are the units of Brahmic scripts: a base
+ * consonant or independent vowel, possibly preceded by a repha and joined to
+ * further consonants by linking viramas, followed by its dependent vowels and
+ * other marks. Thai and Lao leading vowels start a syllable with the
+ * following consonant. Contrary to extended grapheme clusters, a visible
+ * virama (Indic_Conjunct_Break=Extend) ends the syllable, ZWNJ stops a
+ * conjunct, and consonants only join a conjunct of their own script.
+ *
+ * Syllable boundaries are a subset of grapheme cluster boundaries: syllables
+ * are made of whole grapheme clusters. Where the syllable rules would split
+ * a cluster (e.g. a dependent vowel after a Latin letter), the cluster wins.
+ *
+ * Like grapheme cluster boundaries, syllable boundaries only depend on the
+ * codepoints before them and are reported as soon as the codepoint after them
+ * is known.
+ *
+ * @see MiniUCD_SyllableBreakInit
+ * @see MiniUCD_SyllableBreakPush
+ * @see MiniUCD_SyllableBreakFeed
+ * @see MiniUCD_SyllableBreakEnd
+ * @see http://www.unicode.org/reports/tr44/#Indic_Syllabic_Category
+ */
+typedef struct MiniUCD_SyllableBreakIterator {
+    int state;                              /*!< State machine state. */
+    MiniUCD_Char base;                      /*!< First codepoint of current
+                                             *   syllable. */
+    MiniUCD_GraphemeBreakIterator grapheme; /*!< Grapheme cluster boundary
+                                             *   iterator. */
+    MiniUCD_RangeCursor cursor;             /*!< Class lookup cursor. */
+} MiniUCD_SyllableBreakIterator;
 
-    const rangeValues = propertyValues[property];
+MINIUCD_DEF void        MiniUCD_SyllableBreakInit(
+                            MiniUCD_SyllableBreakIterator *it);
+MINIUCD_DEF int         MiniUCD_SyllableBreakPush(
+                            MiniUCD_SyllableBreakIterator *it, MiniUCD_Char c,
+                            size_t *boundaries);
+MINIUCD_DEF size_t      MiniUCD_SyllableBreakFeed(
+                            MiniUCD_SyllableBreakIterator *it,
+                            const MiniUCD_Char *text, size_t length,
+                            size_t *boundaries);
+MINIUCD_DEF int         MiniUCD_SyllableBreakEnd(
+                            MiniUCD_SyllableBreakIterator *it,
+                            size_t *boundaries);
 
-    const Property = capitalize(property);
-    const PROPERTY = property.toUpperCase();
-    const padding = " ".repeat(Math.max(0, 10 - property.length));
+/* End of Text Segmentation *//*!\}*/
 
-    //
-    // Range array
-    //
 
-    const ranges = Object.keys(rangeValues).filter((cp) => parseInt(cp) !== 0);
-    const nbRanges = ranges.length + 1;
-%>/**
- * Codepoint ranges of values for UCD property '**<%- property %>**'.
+/***************************************************************************//*!
+ * \defgroup bidi Bidirectional Algorithm
  *
- * Automatically generated from the UCD.
- *<%
-    if (info.type === "boolean") {
-%>
- * @see UCD_VALUE_0_<%- PROPERTY %>
-<%
-    } else {
-%>
- * @see ucdValues_<%- property %>
-<%
-    }
-%> * @see MINIUCD_<%- PROPERTY %>
- */
-static const MiniUCD_Char ucdRanges_<%- property %>[] = {<%-
-  formatArrayValues(ranges)
-%>};
+ * Unicode Bidirectional Algorithm (UAX #9).
+ *
+ * Paragraphs are first resolved into embedding levels, then each line is
+ * reordered from these levels. Working memory is provided by the caller as an
+ * arena, so that a single buffer can be reused for all paragraphs. Paragraphs
+ * without any right-to-left or explicit formatting character (the common
+ * case) are detected with a quick scan and don't touch the arena.
+ *
+ * Mirroring of characters at odd levels (rule L4) is left to the caller, see
+ * MiniUCD_GetProperty_Bmg().
+ *
+ * @see http://unicode.org/reports/tr9/
+ ***************************************************************************\{*/
 
-/**
- * Number of ranges of values for UCD property '**<%- property %>**'.
+/** Maximum explicit embedding level (BD2). */
+#define MINIUCD_BIDI_MAX_DEPTH  125
+
+/** Paragraph level is given by the first strong character (rules P2, P3). */
+#define MINIUCD_BIDI_AUTO       (-1)
+
+MINIUCD_DEF int         MiniUCD_BidiIsLTR(const MiniUCD_Char *text,
+                            size_t length);
+MINIUCD_DEF size_t      MiniUCD_BidiArenaSize(size_t length);
+MINIUCD_DEF int         MiniUCD_BidiResolve(const MiniUCD_Char *text,
+                            size_t length, int paragraphLevel, void *arena,
+                            unsigned char *levels);
+MINIUCD_DEF void        MiniUCD_BidiReorder(const MiniUCD_Char *text,
+                            const unsigned char *levels, size_t length,
+                            int paragraphLevel, size_t *order);
+
+/* End of Bidirectional Algorithm *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup width Display Width
  *
- * Automatically generated from the UCD.
+ * Display width of text in fixed-width (terminal) columns.
  *
- * @see ucdRanges_<%- property %>
- * @see MINIUCD_<%- PROPERTY %>
- */
-#define UCD_NBRANGES_<%- PROPERTY %><%- padding %> <%- nbRanges %>
+ * Widths follow UAX #11 for East Asian characters and common terminal
+ * practice for the rest: controls, nonspacing and enclosing marks, format
+ * characters and default ignorables take no column, wide and fullwidth
+ * characters take two. Ambiguous characters take one or two columns depending
+ * on the context, chosen by the caller.
+ *
+ * Widths are compiled by the generator into a two-level table, so getting the
+ * width of a codepoint costs a single lookup.
+ *
+ * @see http://unicode.org/reports/tr11/
+ ***************************************************************************\{*/
 
-<%
-    //
-    // Value array.
-    //
-    
-    switch (info.type) {
-      case "boolean": {
-        // Boolean property, only store first value as consecutive ranges have
-        // alternating values
-        const rawValue = rangeValues["0x0000"] || 0;
-        const value0 = rawValue === "Y" || rawValue === 1 ? 1 : 0;
-%>/**
- * Value of first range for UCD property '**<%- property %>**'.
+MINIUCD_DEF int         MiniUCD_CharWidth(MiniUCD_Char c, int ambiguousWidth);
+MINIUCD_DEF size_t      MiniUCD_StringWidth(const MiniUCD_Char *text,
+                            size_t length, int ambiguousWidth);
+
+/* End of Display Width *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup identifiers Identifiers
  *
- * This property is boolean, so storing the first value is sufficient as
- * consecutive ranges have alternating values.
+ * Identifier scanning (UAX #31).
  *
- * Automatically generated from the UCD.
+ * Identifiers are scanned directly from UTF-8 input, as found in source code
+ * or configuration files. ASCII characters get a direct lookup, and other
+ * codepoints a single lookup in a class table merging XID_Start, XID_Continue
+ * and NFKC_Quick_Check.
  *
- * @see ucdRanges_<%- property %>
- * @see MINIUCD_<%- PROPERTY %>
+ * @see http://unicode.org/reports/tr31/
+ ***************************************************************************\{*/
+
+/**
+ * Identifier scanning options.
+ *
+ * @see MiniUCD_ScanIdentifier
  */
-#define UCD_VALUE_0_<%- PROPERTY %><%- padding %>  <%- value0 %>
-<%
-        break;
-      }
+#define MINIUCD_IDENTIFIER_NFKC         0x01 /*!< Stop at characters that
+                                              *   can't occur in
+                                              *   NFKC-normalized text
+                                              *   (NFKC_Quick_Check=No). */
+#define MINIUCD_IDENTIFIER_UNDERSCORE   0x02 /*!< Accept '_' as a start
+                                              *   character, as in most
+                                              *   programming languages. */
 
-      case "enum": {
-        // Enumerated values.
-        const values = Object.values(rangeValues);
-        const enumValues = values.map(value => 
-          `MINIUCD_${PROPERTY}_${toConstant(value)}`
-        );
-%>/**
- * Per-range values for UCD property '**<%- property %>**'.
+MINIUCD_DEF size_t      MiniUCD_ScanIdentifier(const unsigned char *utf8,
+                            size_t length, int options);
+
+/* End of Identifiers *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup scripts Script Runs
  *
- * Automatically generated from the UCD.
+ * Script itemization (UAX #24).
  *
- * @see ucdRanges_<%- property %>
- * @see MINIUCD_<%- PROPERTY %>
- * @see MiniUCD_<%- Property %>
+ * Text is split into maximal runs of the same script, as needed before
+ * shaping. Common and Inherited characters take the script of the run they
+ * appear in, and characters used by several scripts narrow down the script of
+ * their run using their Script_Extensions list. Paired brackets take the
+ * script of their opening bracket, so that a bracketed piece of text in
+ * another script doesn't carry away the closing bracket.
+ *
+ * @see http://unicode.org/reports/tr24/
+ ***************************************************************************\{*/
+
+/** Maximum nesting depth of paired brackets tracked by script run iterators;
+ *  deeper brackets replace the outermost ones. */
+#define MINIUCD_SCRIPTRUN_MAX_BRACKETS  32
+
+/*
+ * Pseudo-scripts of augmented script sets (UTS #39 section 5.1), numbered
+ * after the last #MiniUCD_Sc value.
  */
-static const MiniUCD_<%- Property %> ucdValues_<%- property %>[] = {<%-
-  formatArrayValues(enumValues, 4)
-%>};
-<%
-        break;
-      }
+#define MINIUCD_SCRIPTSET_HANB      (MINIUCD_SC_NBVALUES+1) /*!< Han with
+                                                             *   Bopomofo. */
+#define MINIUCD_SCRIPTSET_JPAN      (MINIUCD_SC_NBVALUES+2) /*!< Japanese. */
+#define MINIUCD_SCRIPTSET_KORE      (MINIUCD_SC_NBVALUES+3) /*!< Korean. */
 
-      case "cp": {
-        // Codepoint offset values.
-        const values = Object.values(rangeValues);
-%>/**
- * Per-range values for UCD property '**<%- property %>**'.
+/** Number of words in script sets. */
+#define MINIUCD_SCRIPTSET_WORDS     ((MINIUCD_SC_NBVALUES+3)/32+1)
+
+/**
+ * Set of scripts, as a fixed-width bitset indexed by #MiniUCD_Sc values (and
+ * pseudo-scripts #MINIUCD_SCRIPTSET_HANB, #MINIUCD_SCRIPTSET_JPAN and
+ * #MINIUCD_SCRIPTSET_KORE), 32 bits per word.
+ */
+typedef struct MiniUCD_ScriptSet {
+    unsigned long bits[MINIUCD_SCRIPTSET_WORDS]; /*!< Bits. */
+} MiniUCD_ScriptSet;
+
+/**
+ * Script run.
  *
- * This property is single-codepoint, stored as offsets from the codepoint
- * value so as to build large ranges of identical values.
+ * @see MiniUCD_ScriptRunIterator
+ */
+typedef struct MiniUCD_ScriptRun {
+    size_t start;      /*!< Index of first codepoint. */
+    size_t end;        /*!< Index after last codepoint. */
+    MiniUCD_Sc script; /*!< Script of run, #MINIUCD_SC_ZYYY if the run only
+                        *   contains Common or Inherited characters. */
+} MiniUCD_ScriptRun;
+
+/**
+ * Script run iterator.
  *
- * Automatically generated from the UCD.
+ * Iterators are fed one codepoint at a time and report each run as soon as
+ * the codepoint after it is known. Script lookups use a range cursor, so
+ * running text in a single script seldom needs a new binary search.
  *
- * @see ucdRanges_<%- property %>
- * @see MINIUCD_<%- PROPERTY %>
+ * @see MiniUCD_ScriptRunInit
+ * @see MiniUCD_ScriptRunPush
+ * @see MiniUCD_ScriptRunFeed
+ * @see MiniUCD_ScriptRunEnd
  */
-static const MiniUCD_Char ucdValues_<%- property %>[] = {<%-
-  formatArrayValues(values, 16)
-%>};
-<%
-        break;
-      }
+typedef struct MiniUCD_ScriptRunIterator {
+    size_t index;               /*!< Index of next codepoint. */
+    size_t start;               /*!< Index of first codepoint of current
+                                 *   run. */
+    MiniUCD_Sc script;          /*!< Script of current run,
+                                 *   #MINIUCD_SC_ZYYY while unresolved. */
+    MiniUCD_ScriptSet scripts;  /*!< Candidate scripts of current run. */
+    int nbBrackets;             /*!< Number of open brackets. */
+    int runBrackets;            /*!< First open bracket of current run. */
 
-      case "numeric":
-      case "string":
-      case "mcp":
-      case "enumList": {
-        // Value array contains indices to an atom array storing unique values.
-        // Note: numeric properties are stored as strings.
-        const values = Object.values(rangeValues);
-        const [indices, uniqueValues] = processRangeValues(values, info.type);
-        const valueType =
-          indices.length < 256
-            ? "char"
-            : indices.length < 65536
-            ? "short"
-            : "int";
-%>/**
- * Per-range atom indices for UCD property '**<%- property %>**'.
+    /*! Open brackets. */
+    struct {
+        MiniUCD_Char bracket;   /*!< Canonical opening bracket. */
+        MiniUCD_Sc script;      /*!< Script of run containing bracket. */
+    } brackets[MINIUCD_SCRIPTRUN_MAX_BRACKETS];
+
+    MiniUCD_RangeCursor cursor; /*!< Script lookup cursor. */
+} MiniUCD_ScriptRunIterator;
+
+MINIUCD_DEF void        MiniUCD_ScriptRunInit(MiniUCD_ScriptRunIterator *it);
+MINIUCD_DEF int         MiniUCD_ScriptRunPush(MiniUCD_ScriptRunIterator *it,
+                            MiniUCD_Char c, MiniUCD_ScriptRun *run);
+MINIUCD_DEF size_t      MiniUCD_ScriptRunFeed(MiniUCD_ScriptRunIterator *it,
+                            const MiniUCD_Char *text, size_t length,
+                            MiniUCD_ScriptRun *runs);
+MINIUCD_DEF int         MiniUCD_ScriptRunEnd(MiniUCD_ScriptRunIterator *it,
+                            MiniUCD_ScriptRun *run);
+
+/* End of Script Runs *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup security Mixed-Script Detection
  *
- * This array stores the index of the value in the atom array for each range. 
- * Atoms are stored in the separate array #ucdAtoms_<%- property %>.
+ * Mixed-script detection for identifiers (UTS #39 section 5).
  *
- * Automatically generated from the UCD.
+ * Strings are classified by restriction level, from the resolved script set
+ * of their characters: the intersection of their augmented Script_Extensions
+ * sets. Script sets are fixed-width bitsets, so each character costs a
+ * handful of word operations.
  *
- * @see ucdRanges_<%- property %>
- * @see ucdAtoms_<%- property %>
- * @see MINIUCD_<%- PROPERTY %>
- */
-static const unsigned <%- valueType %> ucdValues_<%- property %>[] = {<%-
-  formatArrayValues(indices, 16)
-%>};
+ * @see http://unicode.org/reports/tr39/#Mixed_Script_Detection
+ ***************************************************************************\{*/
 
 /**
- * Atoms for UCD property '**<%- property %>**'.
- *
- * Automatically generated from the UCD.
+ * Restriction levels (UTS #39 section 5.2), from most to least restrictive.
  *
- * @see ucdValues_<%- property %>
- * @see MINIUCD_<%- PROPERTY %>
-<%
+ * @see MiniUCD_GetRestrictionLevel
+ */
+typedef enum MiniUCD_RestrictionLevel {
+    /** Only ASCII characters. */
+    MINIUCD_RESTRICTION_ASCII_ONLY=1,
+
+    /** All characters share a script. */
+    MINIUCD_RESTRICTION_SINGLE_SCRIPT,
+
+    /** Covered by Latin + Han + Hiragana + Katakana, Latin + Han + Bopomofo,
+     *  or Latin + Han + Hangul. */
+    MINIUCD_RESTRICTION_HIGHLY_RESTRICTIVE,
+
+    /** Covered by Latin and one other Recommended script, except Cyrillic
+     *  and Greek. */
+    MINIUCD_RESTRICTION_MODERATELY_RESTRICTIVE,
+
+    /** Any mix of Recommended scripts. */
+    MINIUCD_RESTRICTION_MINIMALLY_RESTRICTIVE,
+
+    /** Characters from other scripts. */
+    MINIUCD_RESTRICTION_UNRESTRICTED,
+} MiniUCD_RestrictionLevel;
+
+MINIUCD_DEF int         MiniUCD_GetResolvedScriptSet(const MiniUCD_Char *text,
+                            size_t length, MiniUCD_ScriptSet *set);
+MINIUCD_DEF MiniUCD_RestrictionLevel MiniUCD_GetRestrictionLevel(
+                            const MiniUCD_Char *text, size_t length);
+
+/* End of Mixed-Script Detection *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup numeric Numeric Values
+ *
+ * Numeric values of characters as numbers rather than strings.
+ *
+ * Numeric_Value is stored as a rational, so that values such as 1/2 or
+ * 10000000000 need no parsing. Decimal digits of all scripts get a dedicated
+ * fast path.
+ *
+ * @see MiniUCD_GetProperty_Nv
+ ***************************************************************************\{*/
+
+MINIUCD_DEF int         MiniUCD_GetNumericValue(MiniUCD_Char c,
+                            int64_t *numerator, int64_t *denominator);
+MINIUCD_DEF int         MiniUCD_GetNumericDouble(MiniUCD_Char c,
+                            double *value);
+MINIUCD_DEF int         MiniUCD_GetDigitValue(MiniUCD_Char c);
+MINIUCD_DEF size_t      MiniUCD_ParseDigits(const MiniUCD_Char *text,
+                            size_t length, uint64_t *value);
+
+/* End of Numeric Values *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup emoji Emoji Sequences
+ *
+ * Emoji sequence recognition (UTS #51).
+ *
+ * Sequences are recognized by a state machine over a single emoji class per
+ * codepoint, derived from the Emoji, Emoji_Presentation, Emoji_Modifier,
+ * Emoji_Modifier_Base, Emoji_Component, Extended_Pictographic and
+ * Regional_Indicator properties, so each codepoint costs one lookup.
+ *
+ * Sequences are recognized from their form only, whether or not they are
+ * recommended for general interchange (RGI).
+ *
+ * @see http://unicode.org/reports/tr51/#Emoji_Sequences
+ ***************************************************************************\{*/
+
+/**
+ * Emoji sequence types.
+ *
+ * @see MiniUCD_EmojiSequence
+ */
+typedef enum MiniUCD_EmojiType {
+    /** Single emoji, with emoji presentation by default or followed by
+     *  VS16 (emoji presentation sequence). */
+    MINIUCD_EMOJISEQ_BASIC=1,
+
+    /** Keycap sequence: 0-9, # or *, VS16, then U+20E3. */
+    MINIUCD_EMOJISEQ_KEYCAP,
+
+    /** Emoji modifier sequence: modifier base and skin tone. */
+    MINIUCD_EMOJISEQ_MODIFIER,
+
+    /** Flag sequence: pair of regional indicators. */
+    MINIUCD_EMOJISEQ_FLAG,
+
+    /** Tag sequence, e.g. subdivision flags. */
+    MINIUCD_EMOJISEQ_TAG,
+
+    /** ZWJ sequence: emoji joined by ZERO WIDTH JOINER. */
+    MINIUCD_EMOJISEQ_ZWJ,
+} MiniUCD_EmojiType;
+
+/**
+ * Emoji sequence found in text.
+ *
+ * @see MiniUCD_NextEmojiSequence
+ */
+typedef struct MiniUCD_EmojiSequence {
+    size_t start;           /*!< Index of first codepoint. */
+    size_t end;             /*!< Index past last codepoint. */
+    MiniUCD_EmojiType type; /*!< Sequence type. */
+} MiniUCD_EmojiSequence;
+
+MINIUCD_DEF int         MiniUCD_NextEmojiSequence(const MiniUCD_Char *text,
+                            size_t length, size_t index,
+                            MiniUCD_EmojiSequence *sequence);
+
+/* End of Emoji Sequences *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup vertical Vertical Orientation
+ *
+ * Orientation runs for vertical text layout (UAX #50).
+ *
+ * Text is split into maximal runs of grapheme clusters with the same
+ * Vertical_Orientation, so that each run can be laid out upright or rotated
+ * at once. A grapheme cluster takes the orientation of its base character,
+ * except that an upright enclosing mark (e.g. U+20DD COMBINING ENCLOSING
+ * CIRCLE) makes the whole cluster upright.
+ *
+ * @see http://unicode.org/reports/tr50/
+ ***************************************************************************\{*/
+
+/**
+ * Vertical orientation run.
+ *
+ * @see MiniUCD_VerticalRunIterator
+ */
+typedef struct MiniUCD_VerticalRun {
+    size_t start;           /*!< Index of first codepoint. */
+    size_t end;             /*!< Index after last codepoint. */
+    MiniUCD_Vo orientation; /*!< Orientation of run. */
+} MiniUCD_VerticalRun;
+
+/**
+ * Vertical orientation run iterator.
+ *
+ * Iterators are fed one codepoint at a time and report each run once its
+ * last grapheme cluster is complete. Orientation lookups use a range cursor,
+ * so long runs of ideographs seldom need a new binary search.
+ *
+ * @see MiniUCD_VerticalRunInit
+ * @see MiniUCD_VerticalRunPush
+ * @see MiniUCD_VerticalRunFeed
+ * @see MiniUCD_VerticalRunEnd
+ */
+typedef struct MiniUCD_VerticalRunIterator {
+    size_t start;                           /*!< Index of first codepoint of
+                                             *   current run. */
+    MiniUCD_Vo orientation;                 /*!< Orientation of current
+                                             *   run. */
+    size_t cluster;                         /*!< Index of first codepoint of
+                                             *   current grapheme cluster. */
+    MiniUCD_Vo clusterOrientation;          /*!< Orientation of current
+                                             *   grapheme cluster. */
+    MiniUCD_GraphemeBreakIterator grapheme; /*!< Grapheme cluster boundary
+                                             *   iterator. */
+    MiniUCD_RangeCursor cursor;             /*!< Orientation lookup
+                                             *   cursor. */
+} MiniUCD_VerticalRunIterator;
+
+MINIUCD_DEF void        MiniUCD_VerticalRunInit(
+                            MiniUCD_VerticalRunIterator *it);
+MINIUCD_DEF int         MiniUCD_VerticalRunPush(
+                            MiniUCD_VerticalRunIterator *it, MiniUCD_Char c,
+                            MiniUCD_VerticalRun *run);
+MINIUCD_DEF size_t      MiniUCD_VerticalRunFeed(
+                            MiniUCD_VerticalRunIterator *it,
+                            const MiniUCD_Char *text, size_t length,
+                            MiniUCD_VerticalRun *runs);
+MINIUCD_DEF int         MiniUCD_VerticalRunEnd(
+                            MiniUCD_VerticalRunIterator *it,
+                            MiniUCD_VerticalRun *runs);
+
+/* End of Vertical Orientation *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup joining Cursive Joining
+ *
+ * Contextual forms of cursive scripts such as Arabic, Syriac, N'Ko or
+ * Mongolian.
+ *
+ * Forms are resolved in a single pass by a state machine over a joining class
+ * per character, derived from Joining_Type and Joining_Group. Transparent
+ * characters (e.g. Arabic harakat) are skipped, so that letters join across
+ * them.
+ *
+ * @see https://www.unicode.org/versions/latest/core-spec/chapter-9/#G7462
+ ***************************************************************************\{*/
+
+/**
+ * Joining forms, named after the corresponding OpenType features.
+ *
+ * @see MiniUCD_ResolveJoiningForms
+ */
+typedef enum MiniUCD_JoiningForm {
+    /** Not subject to joining: non-joining or transparent character. */
+    MINIUCD_FORM_NONE=0,
+
+    /** Isolated form. */
+    MINIUCD_FORM_ISOL,
+
+    /** Final form, joined on the right side. */
+    MINIUCD_FORM_FINA,
+
+    /** Syriac Alaph final form, after a non-joining letter. */
+    MINIUCD_FORM_FIN2,
+
+    /** Syriac Alaph final form, after Dalath or Rish. */
+    MINIUCD_FORM_FIN3,
+
+    /** Medial form, joined on both sides. */
+    MINIUCD_FORM_MEDI,
+
+    /** Syriac Alaph medial form. */
+    MINIUCD_FORM_MED2,
+
+    /** Initial form, joined on the left side. */
+    MINIUCD_FORM_INIT,
+} MiniUCD_JoiningForm;
+
+MINIUCD_DEF void        MiniUCD_ResolveJoiningForms(const MiniUCD_Char *text,
+                            size_t length, unsigned char *forms);
+
+/* End of Cursive Joining *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup ordering Canonical Ordering
+ *
+ * Canonical Ordering Algorithm (Core Specification section 3.11), apart from
+ * full normalization.
+ *
+ * Runs of non-starters (characters with a nonzero Canonical_Combining_Class)
+ * are sorted by combining class, keeping characters of the same class in
+ * their original order. Runs are checked first and only sorted when out of
+ * order, which is rare in practice.
+ *
+ * @see https://www.unicode.org/versions/latest/core-spec/chapter-3/#G49591
+ ***************************************************************************\{*/
+
+MINIUCD_DEF int         MiniUCD_CanonicalOrder(MiniUCD_Char *text,
+                            size_t length);
+
+/* End of Canonical Ordering *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup filtering Text Filtering
+ *
+ * Trimming, whitespace collapsing and removal of invisible characters in
+ * UTF-8 text, e.g. to sanitize user input.
+ *
+ * White space is given by White_Space, or Pattern_White_Space for syntax.
+ * Invisible characters are Default_Ignorable_Code_Point characters such as
+ * ZERO WIDTH SPACE or BYTE ORDER MARK, and optionally control characters.
+ * Runs of printable ASCII characters are skipped a machine word at a time,
+ * and only other characters are decoded and looked up.
+ *
+ * Invalid UTF-8 bytes are kept as is and are not considered white space.
+ ***************************************************************************\{*/
+
+/*
+ * Text filtering options.
+ */
+#define MINIUCD_FILTER_PATTERN_SPACE    0x01 /*!< Use Pattern_White_Space
+                                              *   rather than White_Space. */
+#define MINIUCD_FILTER_CONTROLS         0x02 /*!< Also strip control
+                                              *   characters (gc=Cc) other
+                                              *   than white space. */
+#define MINIUCD_FILTER_KEEP_JOINERS     0x04 /*!< Keep ZWJ, ZWNJ and
+                                              *   variation selectors, which
+                                              *   are meaningful in emoji
+                                              *   and Indic sequences. */
+
+MINIUCD_DEF size_t      MiniUCD_Trim(const unsigned char *utf8,
+                            size_t length, int options, size_t *start);
+MINIUCD_DEF size_t      MiniUCD_StripDefaultIgnorables(
+                            const unsigned char *utf8, size_t length,
+                            int options, unsigned char *out);
+MINIUCD_DEF size_t      MiniUCD_CollapseWhitespace(const unsigned char *utf8,
+                            size_t length, int options, unsigned char *out);
+
+/* End of Text Filtering *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup lookup Property Lookup
+ *
+ * Lookup of properties and values by name, and extraction of the codepoint
+ * ranges matching a property value, e.g. to build regular expression classes
+ * such as `\p{sc=Greek}` at pattern compile time.
+ *
+ * Names are matched loosely as per UAX #44 LM3: case, spaces, underscores,
+ * hyphens and an initial "is" prefix are ignored, so that "Script",
+ * "is_script" and "SCRIPT" all designate #MINIUCD_SC. Property and value
+ * aliases are looked up in a generated hash table.
+ *
+ * Ranges are available for boolean and enumerated properties, as well as
+ * #MINIUCD_SCX. General Category groups such as 'L' or 'LC' are given values
+ * past #MINIUCD_GC_NBVALUES.
+ ***************************************************************************\{*/
+
+MINIUCD_DEF MiniUCD_Property MiniUCD_LookupProperty(const char *name,
+                            size_t length);
+MINIUCD_DEF int         MiniUCD_LookupPropertyValue(MiniUCD_Property property,
+                            const char *name, size_t length);
+MINIUCD_DEF size_t      MiniUCD_GetPropertyRanges(MiniUCD_Property property,
+                            int value, MiniUCD_Char *ranges, size_t size);
+
+/* End of Property Lookup *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup caseClosure Case Closure
+ *
+ * Case-insensitive matching of codepoint sets.
+ *
+ * Codepoints related by the simple case mappings (Simple_Case_Folding,
+ * Simple_Lowercase_Mapping, Simple_Uppercase_Mapping and
+ * Simple_Titlecase_Mapping) form case orbits, e.g. 'K', 'k' and KELVIN SIGN.
+ * Orbits are precomputed by the generator into a compact table giving the
+ * next codepoint of each orbit; runs of alternating uppercase and lowercase
+ * pairs, frequent in Latin, Greek and Cyrillic blocks, take a single entry.
+ ***************************************************************************\{*/
+
+/**
+ * Number of codepoints having case variants. This bounds the number of
+ * ranges that MiniUCD_CaseCloseRanges() adds to its input.
+ */
+#define MINIUCD_CASE_NBVARIANTS     <%- caseOrbitTable.nbVariants %>
+
+MINIUCD_DEF MiniUCD_Char MiniUCD_NextCaseVariant(MiniUCD_Char c);
+MINIUCD_DEF size_t      MiniUCD_CaseCloseRanges(const MiniUCD_Char *ranges,
+                            size_t nbRanges, MiniUCD_Char *closure,
+                            size_t size);
+
+/* End of Case Closure *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup utf8Automata UTF-8 Automata
+ *
+ * Codepoint sets compiled to byte-range automata, for regular expression
+ * engines and scanners that match UTF-8 text byte by byte without decoding
+ * it.
+ *
+ * Set ranges are split into sequences of byte ranges of the same encoded
+ * length, e.g. U+0391..U+03A9 gives CE [91-A9], then sequences are compiled
+ * into a minimal acyclic automaton where they share common prefixes and
+ * suffixes: for instance, all 3-byte sequences whose trailing bytes span any
+ * continuation byte end with the same two states. Surrogates, overlong
+ * encodings and other ill-formed sequences are never matched.
+ *
+ * The generator can also emit automata as static tables, identical to the
+ * runtime output, with `ucdGenerate.js --utf8 <file> <class>...` where each
+ * class is a regular expression class name (e.g. "alpha"), a property and
+ * value (e.g. "sc=Greek") or a bare binary property, General Category or
+ * Script value.
+ ***************************************************************************\{*/
+
+/** Target of transitions that complete a sequence. */
+#define MINIUCD_UTF8_ACCEPT         0
+
+/**
+ * UTF-8 automaton transition.
+ *
+ * Automata are arrays of states, each state being stored as consecutive
+ * transitions with ascending and disjoint byte ranges, the last one being
+ * flagged by @p end. The start state comes first.
+ *
+ * @see MiniUCD_CompileUtf8Automaton
+ * @see MiniUCD_MatchUtf8Automaton
+ */
+typedef struct MiniUCD_Utf8Transition {
+    unsigned char first; /*!< First byte of range. */
+    unsigned char last;  /*!< Last byte of range. */
+    unsigned char end;   /*!< Nonzero for the last transition of a state. */
+    unsigned int next;   /*!< Index of the first transition of the next
+                          *   state, or #MINIUCD_UTF8_ACCEPT. */
+} MiniUCD_Utf8Transition;
+
+MINIUCD_DEF size_t      MiniUCD_CompileUtf8Automaton(
+                            const MiniUCD_Char *ranges, size_t nbRanges,
+                            MiniUCD_Utf8Transition *automaton, size_t size);
+MINIUCD_DEF size_t      MiniUCD_MatchUtf8Automaton(
+                            const MiniUCD_Utf8Transition *automaton,
+                            const unsigned char *utf8, size_t length);
+
+/* End of UTF-8 Automata *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup ctype Character Types
+ *
+ * Unicode-aware classification of codepoints into the POSIX character types
+ * of `<ctype.h>` and regular expression classes, e.g. to back locale facets.
+ *
+ * Types follow the regular expression classes of regc_ucd.inc: alpha is
+ * gc=L, digit is gc=Nd, punct is gc=P or gc=S, space is White_Space, graph
+ * excludes gc=Z and gc=C, print only excludes gc=C, and xdigit is limited to
+ * ASCII. All types are fused by the generator into a single class table, so
+ * that one lookup gives the full mask; ASCII characters get a direct lookup
+ * table, and bulk functions reuse the last range found across runs of
+ * codepoints.
+ ***************************************************************************\{*/
+
+/*
+ * Character type flags.
+ */
+#define MINIUCD_CTYPE_SPACE         0x0001 /*!< White space. */
+#define MINIUCD_CTYPE_PRINT         0x0002 /*!< Printable characters. */
+#define MINIUCD_CTYPE_CNTRL         0x0004 /*!< Control characters. */
+#define MINIUCD_CTYPE_UPPER         0x0008 /*!< Uppercase letters. */
+#define MINIUCD_CTYPE_LOWER         0x0010 /*!< Lowercase letters. */
+#define MINIUCD_CTYPE_ALPHA         0x0020 /*!< Letters. */
+#define MINIUCD_CTYPE_DIGIT         0x0040 /*!< Decimal digits. */
+#define MINIUCD_CTYPE_PUNCT         0x0080 /*!< Punctuation and symbols. */
+#define MINIUCD_CTYPE_XDIGIT        0x0100 /*!< Hexadecimal digits. */
+#define MINIUCD_CTYPE_BLANK         0x0200 /*!< Space separators and tab. */
+#define MINIUCD_CTYPE_GRAPH         0x0400 /*!< Visible characters. */
+#define MINIUCD_CTYPE_WORD          0x0800 /*!< Word characters (letters,
+                                            *   numbers and connector
+                                            *   punctuation). */
+
+/** Letters and digits. */
+#define MINIUCD_CTYPE_ALNUM         (MINIUCD_CTYPE_ALPHA|MINIUCD_CTYPE_DIGIT)
+
+/** Number of character type flags. */
+#define MINIUCD_CTYPE_NBFLAGS       12
+
+MINIUCD_DEF int         MiniUCD_GetCtype(MiniUCD_Char c);
+MINIUCD_DEF void        MiniUCD_GetCtypes(const MiniUCD_Char *text,
+                            size_t length, unsigned short *masks);
+MINIUCD_DEF size_t      MiniUCD_ScanCtype(const MiniUCD_Char *text,
+                            size_t length, int mask);
+MINIUCD_DEF size_t      MiniUCD_ScanNotCtype(const MiniUCD_Char *text,
+                            size_t length, int mask);
+
+/* End of Character Types *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup spans Property Spans
+ *
+ * Spans of UTF-8 text over codepoint sets, e.g. to skip runs of letters,
+ * white space or digits in parsers. This follows ICU's span() and spanBack().
+ *
+ * Sets are built from sorted, disjoint codepoint ranges, typically given by
+ * MiniUCD_GetPropertyRanges() for a property value such as Alphabetic,
+ * White_Space or gc=Nd. Membership of ASCII characters is precomputed into
+ * a 128-bit bitmap, so that ASCII bytes take a single bit test; only
+ * multibyte sequences are decoded and looked up in the ranges.
+ *
+ * Invalid UTF-8 bytes are never members of sets.
+ ***************************************************************************\{*/
+
+/**
+ * Codepoint set for span functions.
+ *
+ * Ranges are not copied and must remain valid as long as the set is used.
+ *
+ * @see MiniUCD_InitSet
+ */
+typedef struct MiniUCD_Set {
+    unsigned long ascii[4];     /*!< Bitmap of ASCII members, 32 codepoints
+                                 *   per word. */
+    const MiniUCD_Char *ranges; /*!< Codepoint ranges as first/last pairs. */
+    size_t nbRanges;            /*!< Number of ranges. */
+} MiniUCD_Set;
+
+MINIUCD_DEF void        MiniUCD_InitSet(MiniUCD_Set *set,
+                            const MiniUCD_Char *ranges, size_t nbRanges);
+MINIUCD_DEF size_t      MiniUCD_Span(const MiniUCD_Set *set,
+                            const unsigned char *utf8, size_t length,
+                            int contained);
+MINIUCD_DEF size_t      MiniUCD_SpanBack(const MiniUCD_Set *set,
+                            const unsigned char *utf8, size_t length,
+                            int contained);
+
+/* End of Property Spans *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup changesWhen Changes-When Scanners
+ *
+ * Prefilters for case mapping and folding transforms, based on the
+ * Changes_When_* properties: scanners give the first character of UTF-8
+ * text that a transform would change, so that callers can return the input
+ * untouched, without copying, when nothing changes. This is the common case
+ * for text that is already lowercase or normalized.
+ *
+ * All six properties are fused by the generator into a single class table.
+ * ASCII characters are tested a machine word at a time against the byte
+ * ranges changed by each transform (e.g. 'A'..'Z' for lowercasing); only
+ * other characters are decoded and looked up.
+ *
+ * Invalid UTF-8 bytes are kept as is and are never reported.
+ ***************************************************************************\{*/
+
+/*
+ * Changes-when flags.
+ */
+#define MINIUCD_CW_LOWERCASED       0x01 /*!< Changes_When_Lowercased. */
+#define MINIUCD_CW_UPPERCASED       0x02 /*!< Changes_When_Uppercased. */
+#define MINIUCD_CW_TITLECASED       0x04 /*!< Changes_When_Titlecased. */
+#define MINIUCD_CW_CASEFOLDED       0x08 /*!< Changes_When_Casefolded. */
+#define MINIUCD_CW_CASEMAPPED       0x10 /*!< Changes_When_Casemapped. */
+#define MINIUCD_CW_NFKC_CASEFOLDED  0x20 /*!< Changes_When_NFKC_Casefolded. */
+
+/** Number of changes-when flags. */
+#define MINIUCD_CW_NBFLAGS          6
+
+MINIUCD_DEF int         MiniUCD_GetChangesWhen(MiniUCD_Char c);
+MINIUCD_DEF size_t      MiniUCD_FirstChangedWhen(const unsigned char *utf8,
+                            size_t length, int mask);
+MINIUCD_DEF size_t      MiniUCD_FirstChangedWhenLowercased(
+                            const unsigned char *utf8, size_t length);
+MINIUCD_DEF size_t      MiniUCD_FirstChangedWhenUppercased(
+                            const unsigned char *utf8, size_t length);
+MINIUCD_DEF size_t      MiniUCD_FirstChangedWhenTitlecased(
+                            const unsigned char *utf8, size_t length);
+MINIUCD_DEF size_t      MiniUCD_FirstChangedWhenCasefolded(
+                            const unsigned char *utf8, size_t length);
+MINIUCD_DEF size_t      MiniUCD_FirstChangedWhenCasemapped(
+                            const unsigned char *utf8, size_t length);
+MINIUCD_DEF size_t      MiniUCD_FirstChangedWhenNFKCCasefolded(
+                            const unsigned char *utf8, size_t length);
+
+/* End of Changes-When Scanners *//*!\}*/
+
+
+/***************************************************************************//*!
+ * \defgroup gcMasks General Category Masks
+ *
+ * General Category values as bit masks, so that tests against groups of
+ * categories such as letters (gc=L) or punctuation (gc=P) take a single AND
+ * instead of one comparison per category: the mask of a value is one bit
+ * shifted by the value, and group masks are the union of their members as
+ * given by `PropertyValueAliases.txt`.
+ *
+ * ASCII characters get a direct lookup table, and batch and span functions
+ * reuse the last range found across runs of codepoints.
+ ***************************************************************************\{*/
+
+/*
+ * General Category value masks.
+ */
+<%
+  for (const aliases of properties.gc.values) {
+    const name = `MINIUCD_GC_MASK_${toConstant(aliases[0])}`;
+%>#define <%- name.padEnd(27) %> (1UL<<MINIUCD_GC_<%- toConstant(aliases[0]) %>) /*!< <%- aliases[1] %>. */
+<%
+  }
+%>
+/*
+ * General Category group masks.
+ */
+<%
+  for (const { aliases, members } of properties.gc.groups) {
+%>/** <%- aliases[1] %>. */
+#define MINIUCD_GC_MASK_<%- toConstant(aliases[0]) %> \
+    (<%- members
+      .map((member) => `MINIUCD_GC_MASK_${toConstant(member)}`)
+      .map((bit, index) => (index > 0 && index % 3 === 0 ? " \\\n    " : "") + bit)
+      .join("|") %>)
+
+<%
+  }
+%>MINIUCD_DEF unsigned long MiniUCD_GetGcMask(MiniUCD_Char c);
+MINIUCD_DEF void        MiniUCD_GetGcMasks(const MiniUCD_Char *text,
+                            size_t length, unsigned long *masks);
+MINIUCD_DEF size_t      MiniUCD_SpanGcMask(const unsigned char *utf8,
+                            size_t length, unsigned long mask,
+                            int contained);
+MINIUCD_DEF size_t      MiniUCD_SpanBackGcMask(const unsigned char *utf8,
+                            size_t length, unsigned long mask,
+                            int contained);
+
+/* End of General Category Masks *//*!\}*/
+
+
+#ifdef MINIUCD_IMPLEMENTATION
+#include <limits.h>
+#include <string.h>
+
+/*
+ * Prototypes for functions used only in this file.
+ */
+
+/*! \cond IGNORE */
+static int              miniucdGetRange(MiniUCD_Char c, 
+                            const MiniUCD_Char *ranges, int nbRanges);
+static int              miniucdGetRangeCursor(MiniUCD_Char c,
+                            const MiniUCD_Char *ranges, int nbRanges,
+                            MiniUCD_RangeCursor *cursor);
+static int              miniucdSegmentStep(unsigned short entry,
+                            size_t index, size_t *deferredPtr,
+                            size_t *boundaries);
+static int              miniucdGetGraphemeBreakClass(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static int              miniucdGetWordBreakClass(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static MiniUCD_SB       miniucdGetSentenceBreakClass(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static int              miniucdGetLineBreakClass(MiniUCD_Char c,
+                            int options, MiniUCD_RangeCursor *cursor);
+static int              miniucdLineBreakStep(unsigned short entry,
+                            size_t index, size_t *deferredPtr,
+                            MiniUCD_LineBreak *breaks);
+static int              miniucdGetSyllableBreakClass(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static MiniUCD_Bc       miniucdGetBidiClass(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static int              miniucdBidiFirstStrong(const unsigned char *types,
+                            const size_t *matching, size_t start, size_t end,
+                            int level);
+static MiniUCD_Char     miniucdBidiBracket(MiniUCD_Char c);
+static void             miniucdBidiResolveSequence(const MiniUCD_Char *text,
+                            const size_t *seq, size_t length,
+                            unsigned char *types, const unsigned char *orig,
+                            size_t *pairs, const unsigned char *levels,
+                            int sos, int eos);
+static size_t           miniucdDecodeUtf8(const unsigned char *utf8,
+                            size_t length, MiniUCD_Char *c);
+static int              miniucdIsIdentifierClass(int cls, int start,
+                            int options);
+static const unsigned char * miniucdGetScripts(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor,
+                            unsigned char *single);
+static void             miniucdScriptRunResolve(
+                            MiniUCD_ScriptRunIterator *it, MiniUCD_Sc script);
+static const unsigned long * miniucdGetScriptSet(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static int              miniucdGetDigitZero(MiniUCD_Char c);
+static int              miniucdGetEmojiClass(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static MiniUCD_Vo       miniucdGetVerticalOrientation(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static int              miniucdVerticalRunCluster(
+                            MiniUCD_VerticalRunIterator *it, size_t index,
+                            MiniUCD_VerticalRun *run);
+static int              miniucdGetJoiningClass(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static MiniUCD_Ccc      miniucdGetCanonicalClass(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static void             miniucdCanonicalSort(MiniUCD_Char *text,
+                            size_t length, MiniUCD_RangeCursor *cursor);
+static void             miniucdCanonicalMerge(MiniUCD_Char *text,
+                            size_t length1, size_t length2,
+                            MiniUCD_RangeCursor *cursor);
+static void             miniucdReverse(MiniUCD_Char *text, size_t length);
+static size_t           miniucdScanPrintableAscii(const unsigned char *utf8,
+                            size_t length);
+static int              miniucdGetTextFilterClass(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static int              miniucdIsSpaceClass(int cls, int options);
+static unsigned long    miniucdHashAlias(int property, const char *name,
+                            size_t length);
+static int              miniucdMatchAlias(const char *alias,
+                            const char *name, size_t length);
+static int              miniucdLookupAlias(int property, const char *name,
+                            size_t length);
+struct ucdRangeSink;
+static void             miniucdAddRangeBounds(struct ucdRangeSink *sink,
+                            MiniUCD_Char first, MiniUCD_Char last);
+static void             miniucdAddRange(struct ucdRangeSink *sink,
+                            const MiniUCD_Char *ranges, int nbRanges,
+                            int index);
+static void             miniucdAddBooleanRanges(struct ucdRangeSink *sink,
+                            const MiniUCD_Char *ranges, int nbRanges,
+                            int odd);
+static int              miniucdInRanges(MiniUCD_Char c,
+                            const MiniUCD_Char *ranges, size_t nbRanges);
+struct ucdUtf8Node;
+struct ucdUtf8Compiler;
+static int              miniucdEncodeUtf8(MiniUCD_Char c,
+                            unsigned char *utf8);
+static void             miniucdAddUtf8Transition(struct ucdUtf8Node *node,
+                            unsigned char first, unsigned char last,
+                            unsigned int next);
+static unsigned int     miniucdCompileUtf8State(
+                            struct ucdUtf8Compiler *compiler,
+                            const MiniUCD_Utf8Transition *transitions,
+                            unsigned int nb);
+static void             miniucdCompileUtf8From(
+                            struct ucdUtf8Compiler *compiler, int depth);
+static void             miniucdAddUtf8Sequence(
+                            struct ucdUtf8Compiler *compiler,
+                            const unsigned char *first,
+                            const unsigned char *last, int length);
+static int              miniucdGetCtype(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static int              miniucdSetContains(const MiniUCD_Set *set,
+                            MiniUCD_Char c, size_t *hint);
+static int              miniucdGetChangesWhen(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+static unsigned long    miniucdGetGcMask(MiniUCD_Char c,
+                            MiniUCD_RangeCursor *cursor);
+struct ucdSpanTest;
+static int              miniucdSpanMatch(struct ucdSpanTest *test,
+                            MiniUCD_Char c);
+static size_t           miniucdSpanForward(struct ucdSpanTest *test,
+                            const unsigned char *utf8, size_t length,
+                            int contained);
+static size_t           miniucdSpanBackward(struct ucdSpanTest *test,
+                            const unsigned char *utf8, size_t length,
+                            int contained);
+/*! \endcond *//* IGNORE */
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_data Compiled UCD Data
+
+Statically compiled Unicode Character Database (UCD).
+
+The Unicode Character Database (UCD) defines a set of properties for every known
+codepoint in the standard. This represents a huge quantity of raw data for over
+one million codepoints. Storing this data as flat C arrays of high level
+structures is not realistic, as it would inflate the size of the compiled binary
+by tens of megabytes and would overburden the client processes' memory.
+
+To solve this problem we compile the UCD in the most compact way possible using
+a combination of techniques:
+
+- Don't store flat arrays of values, but contiguous ranges of values that are
+  binary-searched during lookup; as neighboring codepoints in the UCD often
+  share the same properties, this technique is very efficient.
+- Use enums for all enumerated properties to minimize storage (values fit a
+  single byte in most cases).
+- Boolean properties need only the first value since consecutive ranges have
+  alternate values.
+- Use atom tables for strings and complex datatypes to reuse storage.
+
+That way, all but the name properties are statically defined in the library
+without too much overhead. By comparison the uncompressed textual version of the
+UCD weighs around 15MB, and the grouped XML version around 40MB.
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Rational numeric value.
+ *
+ * @see ucdRationals_nv
+ */
+struct ucdRational {
+    int64_t numerator;   /*!< Numerator. */
+    int64_t denominator; /*!< Denominator, zero for NaN. */
+    double value;        /*!< Value as floating point. */
+};
+
+<%
+  // At this point we have per-property ranges of values, now output C file.
+  // For each property we output two C arrays:
+  //
+  //  - First one is used for indexing; it gives the first codepoint in a
+  //    contiguous range of values (omitting the first entry which is always zero).
+  //    This array is binary-searched during lookup until we find the range
+  //    containing a given codepoint.
+  //  - Second one is used for values. The index computed during lookup in the
+  //    first array gives the index in this second array (1 is added for the
+  //    missing first entry).
+  //  - If the value type is enumerated, values are directly stored in the second
+  //    array. Otherwise, the latter stores an index to a third array containing
+  //    the set of unique values. This can be a C string or the first element in
+  //    a list (usually zero-terminated, depending on the type).
+  //
+  // The code always chooses the shortest integral type for indices & value storage
+  // (e.g. char for values < 256).
+
+  for (const [property, info] of Object.entries(properties)) {
+    if (["deprecated", "name"].includes(info.type)) continue;
+
+    const rangeValues = propertyValues[property];
+
+    const Property = capitalize(property);
+    const PROPERTY = property.toUpperCase();
+    const padding = " ".repeat(Math.max(0, 10 - property.length));
+
+    //
+    // Range array
+    //
+
+    const ranges = Object.keys(rangeValues).filter((cp) => parseInt(cp) !== 0);
+    const nbRanges = ranges.length + 1;
+%>/**
+ * Codepoint ranges of values for UCD property '**<%- property %>**'.
+ *
+ * Automatically generated from the UCD.
+ *<%
+    if (info.type === "boolean") {
+%>
+ * @see UCD_VALUE_0_<%- PROPERTY %>
+<%
+    } else {
+%>
+ * @see ucdValues_<%- property %>
+<%
+    }
+%> * @see MINIUCD_<%- PROPERTY %>
+ */
+static const MiniUCD_Char ucdRanges_<%- property %>[] = {<%-
+  formatArrayValues(ranges)
+%>};
+
+/**
+ * Number of ranges of values for UCD property '**<%- property %>**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdRanges_<%- property %>
+ * @see MINIUCD_<%- PROPERTY %>
+ */
+#define UCD_NBRANGES_<%- PROPERTY %><%- padding %> <%- nbRanges %>
+
+<%
+    //
+    // Value array.
+    //
+    
+    switch (info.type) {
+      case "boolean": {
+        // Boolean property, only store first value as consecutive ranges have
+        // alternating values
+        const rawValue = rangeValues["0x0000"] || 0;
+        const value0 = rawValue === "Y" || rawValue === 1 ? 1 : 0;
+%>/**
+ * Value of first range for UCD property '**<%- property %>**'.
+ *
+ * This property is boolean, so storing the first value is sufficient as
+ * consecutive ranges have alternating values.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdRanges_<%- property %>
+ * @see MINIUCD_<%- PROPERTY %>
+ */
+#define UCD_VALUE_0_<%- PROPERTY %><%- padding %>  <%- value0 %>
+<%
+        if (info.ascii) {
+%>
+/**
+ * Values of ASCII characters for UCD property '**<%- property %>**'.
+ *
+ * Direct lookup table used as a fast path by the accessor.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see MiniUCD_GetProperty_<%- Property %>
+ */
+static const unsigned char ucdAscii_<%- property %>[128] = {<%-
+  formatArrayValues(
+    asciiValues(rangeValues).map(value => (value === "Y" ? 1 : 0)),
+  16)
+%>};
+<%
+        }
+        break;
+      }
+
+      case "enum": {
+        // Enumerated values.
+        const values = Object.values(rangeValues);
+        const enumValues = values.map(value => 
+          `MINIUCD_${PROPERTY}_${toConstant(value)}`
+        );
+%>/**
+ * Per-range values for UCD property '**<%- property %>**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdRanges_<%- property %>
+ * @see MINIUCD_<%- PROPERTY %>
+ * @see MiniUCD_<%- Property %>
+ */
+static const MiniUCD_<%- Property %> ucdValues_<%- property %>[] = {<%-
+  formatArrayValues(enumValues, 4)
+%>};
+<%
+        if (info.ascii) {
+%>
+/**
+ * Values of ASCII characters for UCD property '**<%- property %>**'.
+ *
+ * Direct lookup table used as a fast path by the accessor.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see MiniUCD_GetProperty_<%- Property %>
+ */
+static const MiniUCD_<%- Property %> ucdAscii_<%- property %>[128] = {<%-
+  formatArrayValues(
+    asciiValues(rangeValues).map(value => `MINIUCD_${PROPERTY}_${toConstant(value)}`),
+  4)
+%>};
+<%
+        }
+        break;
+      }
+
+      case "cp": {
+        // Codepoint offset values.
+        const values = Object.values(rangeValues);
+%>/**
+ * Per-range values for UCD property '**<%- property %>**'.
+ *
+ * This property is single-codepoint, stored as offsets from the codepoint
+ * value so as to build large ranges of identical values.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdRanges_<%- property %>
+ * @see MINIUCD_<%- PROPERTY %>
+ */
+static const MiniUCD_Char ucdValues_<%- property %>[] = {<%-
+  formatArrayValues(values, 16)
+%>};
+<%
+        break;
+      }
+
+      case "numeric":
+      case "string":
+      case "mcp":
+      case "enumList": {
+        // Value array contains indices to an atom array storing unique values.
+        // Note: numeric properties are stored as strings.
+        const values = Object.values(rangeValues);
+        const [indices, uniqueValues] = processRangeValues(values, info.type);
+        const valueType =
+          indices.length < 256
+            ? "char"
+            : indices.length < 65536
+            ? "short"
+            : "int";
+%>/**
+ * Per-range atom indices for UCD property '**<%- property %>**'.
+ *
+ * This array stores the index of the value in the atom array for each range. 
+ * Atoms are stored in the separate array #ucdAtoms_<%- property %>.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdRanges_<%- property %>
+ * @see ucdAtoms_<%- property %>
+ * @see MINIUCD_<%- PROPERTY %>
+ */
+static const unsigned <%- valueType %> ucdValues_<%- property %>[] = {<%-
+  formatArrayValues(indices, 16)
+%>};
+
+/**
+ * Atoms for UCD property '**<%- property %>**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdValues_<%- property %>
+ * @see MINIUCD_<%- PROPERTY %>
+<%
         switch (info.type) {
           case "numeric":
           case "string":
@@ -494,262 +1689,5034 @@ static const char * const ucdAtoms_<%- property %>[] = {<%-
     ),
   8)
 %>};
-<%      
+<%
+            if (info.type === "numeric") {
+%>
+/**
+ * Rational values of atoms for UCD property '**<%- property %>**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdAtoms_<%- property %>
+ */
+static const struct ucdRational ucdRationals_<%- property %>[] = {<%-
+  formatArrayValues(
+    uniqueValues.map((atom) => {
+      const { numerator, denominator, value } = parseRational(atom);
+      return `{${numerator}, ${denominator}, ${value}}`;
+    }),
+  4)
+%>};
+<%
+            }
+            break;
+
+          case "mcp": {
+            // NUL-terminated codepoint lists.
+            // - For length=0, zero.
+            // - For length=1, offset then zero.
+            // - For length>1, zero-terminated list of codepoint.
+            const atoms = [];
+            for (const value of uniqueValues) {
+              if (value !== 0 && value !== "0") {
+                // Values.
+                if (Array.isArray(value)) {
+                  atoms.push(...value.map(toHex));
+                } else {
+                  atoms.push(value);
+                }
+              }
+      
+              // Terminator.
+              atoms.push(0);
+            }
+%> */
+static const int ucdAtoms_<%- property %>[] = {<%-
+  formatArrayValues(atoms, 16)
+%>};
+<%
+            break;
+          }
+
+          case "enumList":{
+            // Zero-terminated list of enum values.
+            const elementProperty = info.enumType;
+            const ElementProperty = capitalize(elementProperty);
+            const ELEMENT_PROPERTY = elementProperty.toUpperCase();
+            const nbValues = properties[elementProperty].values.length;
+            const valueType =
+              nbValues < 256 ? "char" : nbValues < 65536 ? "short" : "int";
+            const atomType = `unsigned ${valueType}`;
+            const atoms = [];
+            for (const value of uniqueValues) {
+              if (Array.isArray(value)) {
+                atoms.push(...value);
+              } else {
+                atoms.push(value);
+              }
+
+              // Terminator.
+              atoms.push(0);
+            }
+%> * @see MiniUCD_<%- ElementProperty %>
+ */
+static const unsigned <%- valueType %> ucdAtoms_<%- property %>[] = {<%-
+  formatArrayValues(
+    atoms.map(
+      atom =>
+      atom === 0 ? 0 : `MINIUCD_${ELEMENT_PROPERTY}_${toConstant(atom)}`
+    ),
+  4)
+%>};
+<%      
+            break;
+          }
+        }
+        break;
+      }
+    }
+%>
+<%      
+  }
+%>/** @endcond @endprivate */
+
+/* End of Compiled UCD Data *//*!\}*/
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_classes Compiled Class Tables
+
+Character classes merged from several UCD properties.
+
+Algorithms such as text segmentation need the values of several properties
+for each codepoint. Rather than looking up each property separately, the
+generator merges their ranges into a single table of class indices, so that a
+single binary search gives all the needed information. ASCII characters get a
+direct lookup table.
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+<%
+  for (const { name, classNames, rangeValues, ascii } of classTables) {
+    const NAME = name.toUpperCase();
+    const padding = " ".repeat(Math.max(0, 10 - name.length));
+    const ranges = Object.keys(rangeValues).filter((cp) => parseInt(cp) !== 0);
+    const nbRanges = ranges.length + 1;
+    const constant = (cls) => `UCD_${NAME}_${toConstant(cls)}`;
+%>/*
+ * Classes for table '**<%- name %>**'.
+ */
+<%
+    classNames.forEach((cls, index) => {
+%>#define <%- constant(cls).padEnd(32) %> <%- index %>
+<%
+    });
+%>
+/**
+ * Number of classes for table '**<%- name %>**'.
+ *
+ * Automatically generated from the UCD.
+ */
+#define UCD_<%- NAME %>_NBCLASSES<%- padding %> <%- classNames.length %>
+
+/**
+ * Codepoint ranges of classes for table '**<%- name %>**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdValues_<%- name %>
+ */
+static const MiniUCD_Char ucdRanges_<%- name %>[] = {<%-
+  formatArrayValues(ranges)
+%>};
+
+/**
+ * Number of ranges of classes for table '**<%- name %>**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdRanges_<%- name %>
+ */
+#define UCD_NBRANGES_<%- NAME %><%- padding %> <%- nbRanges %>
+
+/**
+ * Per-range classes for table '**<%- name %>**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdRanges_<%- name %>
+ */
+static const unsigned char ucdValues_<%- name %>[] = {<%-
+  formatArrayValues(Object.values(rangeValues).map(constant), 4)
+%>};
+
+/**
+ * Classes of ASCII characters for table '**<%- name %>**'.
+ *
+ * Automatically generated from the UCD.
+ */
+static const unsigned char ucdAscii_<%- name %>[128] = {<%-
+  formatArrayValues(ascii.map(constant), 4)
+%>};
+
+<%
+  }
+  const ctypeTable = classTables.find(({ name }) => name === "ctype");
+%>/**
+ * Character type masks of classes for table '**ctype**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see MiniUCD_GetCtype
+ */
+static const unsigned short ucdMasks_ctype[UCD_CTYPE_NBCLASSES] = {<%-
+  formatArrayValues(
+    ctypeTable.classNames.map((cls) =>
+      cls === "Other"
+        ? "0"
+        : cls
+            .split("_")
+            .map((flag) => `MINIUCD_CTYPE_${flag.toUpperCase()}`)
+            .join("|")
+    ),
+  1)
+%>};
+<%
+  const changesWhenTable = classTables.find(({ name }) => name === "changesWhen");
+  const changesWhenFlags = Object.fromEntries(
+    ["CWL", "CWU", "CWT", "CWCF", "CWCM", "CWKCF"].map((property, i) => [
+      property,
+      `MINIUCD_CW_${changesWhen.flags[i]}`,
+    ])
+  );
+%>
+/**
+ * Changes-when masks of classes for table '**changesWhen**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see MiniUCD_GetChangesWhen
+ */
+static const unsigned char ucdMasks_changesWhen[UCD_CHANGESWHEN_NBCLASSES] = {<%-
+  formatArrayValues(
+    changesWhenTable.classNames.map((cls) =>
+      cls === "Other"
+        ? "0"
+        : cls
+            .split("_")
+            .map((property) => changesWhenFlags[property])
+            .join("|")
+    ),
+  1)
+%>};
+
+/**
+ * ASCII bytes changed by each transform, as two [first, last] ranges per
+ * MINIUCD_CW_* flag, for word-at-a-time scanning. Ranges may be supersets;
+ * empty ranges are [1, 0].
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see MiniUCD_FirstChangedWhen
+ */
+static const unsigned char ucdAsciiBounds_changesWhen[MINIUCD_CW_NBFLAGS][4] = {<%-
+  formatArrayValues(
+    changesWhen.asciiBounds.map((bounds) =>
+      "{" + bounds.map((b) => "0x" + b.toString(16).toUpperCase().padStart(2, "0")).join(", ") + "}"
+    ),
+  1)
+%>};
+
+/** @endcond @endprivate */
+
+/* End of Compiled Class Tables *//*!\}*/
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_segmentation Compiled Segmentation Rules
+
+Text segmentation rules compiled into state machines.
+
+Each table has one row per state and one column per class (plus one for the
+end of text). Entries give the next state in their lower bits, along with
+flags telling whether there is a boundary before the current codepoint,
+whether this boundary depends on the codepoints that follow, whether a
+previously deferred boundary is confirmed, and for line breaking, whether the
+break is mandatory.
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+/** Boundary before the current codepoint. */
+#define UCD_SEGMENT_BREAK           <%- toHex(segmentationFlags.BREAK) %>
+
+/** Boundary before the current codepoint depends on the following ones. */
+#define UCD_SEGMENT_DEFER           <%- toHex(segmentationFlags.DEFER) %>
+
+/** The previously deferred boundary is confirmed. */
+#define UCD_SEGMENT_BREAK_DEFERRED  <%- toHex(segmentationFlags.BREAK_DEFERRED) %>
+
+/** Boundary before the current codepoint is a mandatory line break. */
+#define UCD_SEGMENT_MANDATORY       <%- toHex(segmentationFlags.MANDATORY) %>
+
+/** Boundary before the current codepoint unless it has the same script as
+ *  the start of the current syllable. */
+#define UCD_SEGMENT_SAME_SCRIPT     <%- toHex(segmentationFlags.SAME_SCRIPT) %>
+
+/** Mask for the next state. */
+#define UCD_SEGMENT_STATE           0x00FF
+
+<%
+  for (const [name, machine] of Object.entries(stateMachines)) {
+    const NAME = name.toUpperCase();
+    const padding = " ".repeat(Math.max(0, 10 - name.length));
+%>/**
+ * Initial state for segmentation table '**<%- name %>**'.
+ *
+ * @see ucdStates_<%- name %>
+ */
+#define UCD_<%- NAME %>_INITIAL<%- padding %>   <%- machine.initial %>
+<%
+    if (machine.pending !== undefined) {
+%>
+/**
+ * First state with a deferred boundary for segmentation table
+ * '**<%- name %>**'. States with a deferred boundary are numbered last.
+ *
+ * @see ucdStates_<%- name %>
+ */
+#define UCD_<%- NAME %>_PENDING<%- padding %>   <%- machine.pending %>
+<%
+    }
+%>
+/**
+ * State machine for segmentation table '**<%- name %>**'.
+ *
+ * Automatically generated from the segmentation rules.
+ */
+static const unsigned short ucdStates_<%- name %>[][<%- machine.columns %>] = {<%
+    machine.states.forEach((state, index) => {
+%>
+    /* <%- index %>: <%- state %> */
+    {<%- formatArrayValues(machine.table[index].map(toHex), 8).trim().replace(/,$/, "") %>},<%
+    });
+%>
+};
+
+<%
+  }
+%>/** @endcond @endprivate */
+
+/* End of Compiled Segmentation Rules *//*!\}*/
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_width Compiled Width Table
+
+Display widths compiled into a two-level table.
+
+Codepoints are split into blocks of 256. The first level gives the index of
+the block data in the second level, where widths are packed as 2-bit values, 4
+per byte. Most blocks are uniform (e.g. all narrow or all wide), so identical
+blocks are shared.
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+/*
+ * Display width values.
+ */
+#define UCD_WIDTH_ZERO              0
+#define UCD_WIDTH_NARROW            1
+#define UCD_WIDTH_WIDE              2
+#define UCD_WIDTH_AMBIGUOUS         3
+
+/**
+ * Block indices for display width table.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdWidthBlocks
+ */
+static const <%- widthTable.blocks.length > 256 ? "unsigned short" : "unsigned char" %> ucdWidthIndex[<%- toHex(widthTable.index.length) %>] = {<%-
+  formatArrayValues(widthTable.index, 16)
+%>};
+
+/**
+ * Blocks of packed display widths.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdWidthIndex
+ */
+static const unsigned char ucdWidthBlocks[][64] = {<%
+  widthTable.blocks.forEach((block, index) => {
+%>
+    /* <%- index %> */
+    {<%- formatArrayValues(block.map((v) => `0x${v.toString(16).toUpperCase().padStart(2, "0")}`), 16).trim().replace(/,$/, "") %>},<%
+  });
+%>
+};
+
+/** @endcond @endprivate */
+
+/* End of Compiled Width Table *//*!\}*/
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_scriptsets Compiled Script Sets
+
+Script_Extensions values compiled into fixed-width bitsets.
+
+Each range of property '**scx**' gets the index of its script set, so that
+set operations are a few word-wide operations instead of list traversals.
+Sets are augmented as described in UTS #39 section 5.1: Han, Hiragana,
+Katakana, Hangul and Bopomofo get the Hanb, Jpan and Kore pseudo-scripts,
+and Common and Inherited get all scripts.
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+<%
+  const formatWords = (words) =>
+    words.map((w) => `0x${w.toString(16).toUpperCase().padStart(8, "0")}UL`).join(", ");
+%>/**
+ * Per-range script set indices for UCD property '**scx**'.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdRanges_scx
+ * @see ucdScriptSets
+ */
+static const unsigned short ucdScriptSetIndices_scx[] = {<%-
+  formatArrayValues(scriptSets.indices, 16)
+%>};
+
+/**
+ * Augmented script sets.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdScriptSetIndices_scx
+ */
+static const unsigned long ucdScriptSets[][MINIUCD_SCRIPTSET_WORDS] = {<%
+  scriptSets.sets.forEach((words) => {
+%>
+    {<%- formatWords(words) %>},<%
+  });
+%>
+};
+<%
+  for (const [name, { description, words }] of Object.entries(scriptSets.named)) {
+%>
+/**
+ * <%- description %>
+ */
+static const unsigned long ucdScriptSet_<%- name %>[MINIUCD_SCRIPTSET_WORDS] = {
+    <%- formatWords(words) %>
+};
+<%
+  }
+%>
+/** @endcond @endprivate */
+
+/* End of Compiled Script Sets *//*!\}*/
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_digits Compiled Decimal Digits
+
+Characters with Numeric_Type=Decimal come in contiguous runs of 10 digits,
+from 0 to 9 (this is checked by the generator). Storing the first codepoint of
+each run is enough to get the value of any decimal digit.
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Zero digits of decimal digit sets.
+ *
+ * Automatically generated from the UCD.
+ */
+static const MiniUCD_Char ucdDigitZeros[] = {<%-
+  formatArrayValues(digitZeros.map(toHex))
+%>};
+
+/** Number of decimal digit sets. */
+#define UCD_NBDIGITZEROS            <%- digitZeros.length %>
+
+/** @endcond @endprivate */
+
+/* End of Compiled Decimal Digits *//*!\}*/
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_emoji Compiled Emoji Sequence Rules
+
+Emoji sequence grammar compiled into a state machine.
+
+The table has one row per state and one column per emoji class. Entries give
+the next state in their lower bits, along with the type of the sequence ending
+with the current codepoint, if any, and whether the codepoints so far must be
+rejected (for text presentation sequences).
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+/** Mask for the type of the sequence ending with the current codepoint. */
+#define UCD_EMOJI_TYPE              <%- toHex(emojiSequences.flags.TYPE) %>
+
+/** Shift for the type of the sequence ending with the current codepoint. */
+#define UCD_EMOJI_TYPE_SHIFT        <%- emojiSequences.flags.TYPE_SHIFT %>
+
+/** The codepoints so far don't form an emoji sequence. */
+#define UCD_EMOJI_REJECT            <%- toHex(emojiSequences.flags.REJECT) %>
+
+/** Mask for the next state. */
+#define UCD_EMOJI_STATE             0x00FF
+
+/** Initial state of emoji sequence table. */
+#define UCD_EMOJI_INITIAL           <%- emojiSequences.initial %>
+
+/** Final state of emoji sequence table: no longer sequence is possible. */
+#define UCD_EMOJI_END               <%- emojiSequences.end %>
+
+/**
+ * State machine for emoji sequences.
+ *
+ * Automatically generated from the emoji sequence rules.
+ */
+static const unsigned short ucdStates_emoji[][UCD_EMOJISEQUENCE_NBCLASSES] = {<%
+  emojiSequences.states.forEach((state, index) => {
+%>
+    /* <%- index %>: <%- state %> */
+    {<%- formatArrayValues(emojiSequences.table[index].map(toHex), 8).trim().replace(/,$/, "") %>},<%
+  });
+%>
+};
+
+/** @endcond @endprivate */
+
+/* End of Compiled Emoji Sequence Rules *//*!\}*/
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_joining Compiled Joining Rules
+
+Cursive joining rules compiled into a state machine.
+
+The table has one row per state and one column per joining class. Entries give
+the next state in their lower bits, along with the form of the current
+character and the new form of the previous joining character, if it changes.
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+/** Mask for the new form of the previous joining character. */
+#define UCD_JOINING_PREVIOUS        <%- toHex(0xF << joining.flags.PREVIOUS_SHIFT) %>
+
+/** Shift for the new form of the previous joining character. */
+#define UCD_JOINING_PREVIOUS_SHIFT  <%- joining.flags.PREVIOUS_SHIFT %>
+
+/** Mask for the form of the current character. */
+#define UCD_JOINING_CURRENT         <%- toHex(0xF << joining.flags.CURRENT_SHIFT) %>
+
+/** Shift for the form of the current character. */
+#define UCD_JOINING_CURRENT_SHIFT   <%- joining.flags.CURRENT_SHIFT %>
+
+/** Mask for the next state. */
+#define UCD_JOINING_STATE           0x00FF
+
+/** Initial state of joining table. */
+#define UCD_JOINING_INITIAL         <%- joining.initial %>
+
+/**
+ * State machine for cursive joining.
+ *
+ * Automatically generated from the joining rules.
+ */
+static const unsigned short ucdStates_joining[][UCD_JOINING_NBCLASSES] = {<%
+  joining.states.forEach((state, index) => {
+%>
+    /* <%- index %>: <%- state %> */
+    {<%- formatArrayValues(joining.table[index].map(toHex), 8).trim().replace(/,$/, "") %>},<%
+  });
+%>
+};
+
+/** @endcond @endprivate */
+
+/* End of Compiled Joining Rules *//*!\}*/
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_aliases Compiled Property Aliases
+
+Hash table of property and value names for loose matching lookup.
+
+Names are stored in loosely matched form (lowercase, without spaces,
+underscores and hyphens) and hashed along with the property they belong to, or
+zero for property names. Entries are sorted by hash bucket so that each bucket
+is a contiguous slice of the table.
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Property or value alias.
+ *
+ * @see ucdAliases
+ */
+struct ucdAlias {
+    const char *name;       /*!< Loosely matched name. */
+    unsigned char property; /*!< Property of value, zero for property names. */
+    unsigned short value;   /*!< Property or value. */
+};
+
+/**
+ * Hash table of property and value aliases, sorted by bucket.
+ *
+ * Automatically generated from the UCD files `PropertyAliases.txt` and
+ * `PropertyValueAliases.txt`.
+ *
+ * @see ucdAliasBuckets
+ */
+static const struct ucdAlias ucdAliases[] = {<%
+  for (const { name, property, value } of aliasTable.entries) {
+%>
+    {"<%- name %>", <%- property %>, <%- value %>},<%
+  }
+%>
+};
+
+/** Number of alias hash buckets, a power of two. */
+#define UCD_NBALIASBUCKETS      <%- aliasTable.buckets.length - 1 %>
+
+/**
+ * Index of first alias of each hash bucket, followed by the number of aliases.
+ *
+ * @see ucdAliases
+ */
+static const unsigned short ucdAliasBuckets[UCD_NBALIASBUCKETS+1] = {<%-
+  formatArrayValues(aliasTable.buckets, 16)
+%>};
+
+/** Value namespace of boolean properties. */
+#define UCD_VALUES_BOOLEAN      0xFF
+
+/**
+ * Loosely matched names of boolean values; first half are false.
+ *
+ * @see UCD_VALUES_BOOLEAN
+ */
+static const char * const ucdBooleanAliases[] = {
+    "n", "no", "f", "false", "y", "yes", "t", "true"
+};
+
+/**
+ * Property whose value names apply to each property: itself for enumerated
+ * properties, #UCD_VALUES_BOOLEAN for boolean properties, zero if values
+ * have no names.
+ */
+static const unsigned char ucdValueProperties[MINIUCD_NBPROPERTIES+1] = {
+    0,<%
+  for (const [property, info] of Object.entries(properties)) {
+    if (info.type === "deprecated") continue;
+
+    let valueProperty = "0";
+    if (info.type === "boolean") {
+      valueProperty = "UCD_VALUES_BOOLEAN";
+    } else if (info.type === "enum" && info.values) {
+      valueProperty = `MINIUCD_${property.toUpperCase()}`;
+    } else if (info.type === "enumList") {
+      valueProperty = `MINIUCD_${info.enumType.toUpperCase()}`;
+    }
+%>
+    <%- valueProperty %>, /* <%- property %> */<%
+  }
+%>
+};
+<%
+  for (const [property, info] of Object.entries(properties)) {
+    if (!info.groups) continue;
+
+    const PROPERTY = property.toUpperCase();
+    const padding = " ".repeat(Math.max(0, 10 - property.length));
+%>
+/**
+ * Number of value groups for UCD property '**<%- property %>**'.
+ *
+ * @see ucdGroups_<%- property %>
+ */
+#define UCD_<%- PROPERTY %>_NBGROUPS<%- padding %>   <%- info.groups.length %>
+
+/**
+ * Value masks of groups for UCD property '**<%- property %>**', e.g. 'L' for
+ * all letters. Group values follow #MINIUCD_<%- PROPERTY %>_NBVALUES.
+ *
+ * Automatically generated from the UCD file `PropertyValueAliases.txt`.
+ */
+static const unsigned long ucdGroups_<%- property %>[] = {<%
+    for (const { aliases, members } of info.groups) {
+%>
+    /* <%- aliases.join(", ") %> */
+    <%- members
+      .map((member) => `(1UL<<MINIUCD_${PROPERTY}_${toConstant(member)})`)
+      .map((bit, index) => (index > 0 && index % 3 === 0 ? "\n    " : "") + bit)
+      .join("|") %>,<%
+    }
+%>
+};
+<%
+  }
+%>
+/**
+ * Values of UCD property '**gc**' for ASCII characters.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see MiniUCD_GetGcMask
+ */
+static const unsigned char ucdAscii_gc[128] = {<%-
+  formatArrayValues(gcAscii.map((value) => `MINIUCD_GC_${toConstant(value)}`), 4)
+%>};
+
+/** @endcond @endprivate */
+
+/* End of Compiled Property Aliases *//*!\}*/
+
+
+/*
+===========================================================================*//*!
+\internal \defgroup ucd_case Compiled Case Orbits
+
+Ranges of codepoints sharing the same offset to the next codepoint of their
+case orbit, in ascending order and wrapping around.
+\{*//*==========================================================================
+*/
+
+/** @beginprivate @cond PRIVATE */
+
+/** Case orbit offset of alternating pairs starting at even codepoints. */
+#define UCD_CASEORBIT_EVENODD   1
+
+/** Case orbit offset of alternating pairs starting at odd codepoints. */
+#define UCD_CASEORBIT_ODDEVEN   ((MiniUCD_Char) -1)
+
+/**
+ * Codepoint ranges of case orbit offsets.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdValues_caseOrbit
+ */
+static const MiniUCD_Char ucdRanges_caseOrbit[] = {<%-
+  formatArrayValues(caseOrbitTable.ranges)
+%>};
+
+/**
+ * Number of ranges of case orbit offsets.
+ *
+ * @see ucdRanges_caseOrbit
+ */
+#define UCD_NBRANGES_CASEORBIT  <%- caseOrbitTable.values.length %>
+
+/**
+ * Per-range offsets to the next codepoint of case orbits, zero for
+ * codepoints without case variants.
+ *
+ * Automatically generated from the UCD.
+ *
+ * @see ucdRanges_caseOrbit
+ * @see UCD_CASEORBIT_EVENODD
+ * @see UCD_CASEORBIT_ODDEVEN
+ */
+static const MiniUCD_Char ucdValues_caseOrbit[] = {<%-
+  formatArrayValues(caseOrbitTable.values)
+%>};
+
+/** @endcond @endprivate */
+
+/* End of Compiled Case Orbits *//*!\}*/
+
+
+/*******************************************************************************
+ * UCD Property Accessors
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Get the range index containing the given codepoint.
+ *
+ * @return Range index.*/
+static int
+miniucdGetRange(
+    MiniUCD_Char c,             /*!< Codepoint to lookup. */
+    const MiniUCD_Char *ranges, /*!< Array of ranges boundaries. First one is
+                                     omitted (first codepoint is always zero).*/
+    int nbRanges)               /*!< Number of ranges. */
+{
+    int min, max;
+    if (c < ranges[0] || nbRanges < 2) return 0;
+    if (c >= ranges[nbRanges-2]) return nbRanges-1;
+    for (min=1, max=nbRanges-1; max-min > 1;) {
+        int mid = min+((max-min)>>1);
+        if (c < ranges[mid-1]) max = mid;
+        else min = mid;
+    }
+    return min;
+}
+
+/**
+ * Get the range index containing the given codepoint, using a cursor to skip
+ * the binary search when the codepoint falls within the last range found.
+ *
+ * @return Range index.*/
+static int
+miniucdGetRangeCursor(
+    MiniUCD_Char c,             /*!< Codepoint to lookup. */
+    const MiniUCD_Char *ranges, /*!< Array of ranges boundaries. First one is
+                                     omitted (first codepoint is always zero).*/
+    int nbRanges,               /*!< Number of ranges. */
+    MiniUCD_RangeCursor *cursor)/*!< [in,out] Lookup cursor. */
+{
+    int index;
+    if (c >= cursor->first && c <= cursor->last) return cursor->index;
+    index = miniucdGetRange(c, ranges, nbRanges);
+    cursor->index = index;
+    cursor->first = (index > 0 ? ranges[index-1] : 0);
+    cursor->last = (index < nbRanges-1 ? ranges[index]-1 : 0x10FFFF);
+    return index;
+}
+
+/** @endcond @endprivate */
+<%
+  //
+  // Now generate accessors for all known properties
+  //
+
+  for (const [property, info] of Object.entries(properties)) {
+    if (!info || ["deprecated", "name"].includes(info.type)) continue;
+
+    const Property = capitalize(property);
+    const PROPERTY = property.toUpperCase();
+%>
+/**
+ * Get value of UCD property '**<%- property %>**' for given codepoint.
+ *<%
+    switch (info.type) {
+      case "boolean":
+%>
+ * @return Value of UCD property '**<%- property %>**'.
+ *
+ * @see MINIUCD_<%- PROPERTY %>
+ */
+int
+MiniUCD_GetProperty_<%- Property %>(
+    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+{<%
+        if (info.ascii) {
+%>
+    if (c < 0x80) return ucdAscii_<%- property %>[c];<%
+        }
+%>
+    return (miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)%2)
+        ? !UCD_VALUE_0_<%- PROPERTY %>
+        : UCD_VALUE_0_<%- PROPERTY %>;
+}
+<%
+        break;
+
+      case "enum":
+%>
+ * @return Value of UCD property '**<%- property %>**'.
+ *
+ * @see MINIUCD_<%- PROPERTY %>
+ * @see MiniUCD_<%- Property %>
+ */
+MiniUCD_<%- Property %>
+MiniUCD_GetProperty_<%- Property %>(
+    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+{<%
+        if (info.ascii) {
+%>
+    if (c < 0x80) return ucdAscii_<%- property %>[c];<%
+        }
+%>
+    return ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)];
+}
+<%
+        break;
+
+      case "cp":
+%>
+ * @return Value of UCD property '**<%- property %>**'.
+ *
+ * @see MINIUCD_<%- PROPERTY %>
+ */
+MiniUCD_Char
+MiniUCD_GetProperty_<%- Property %>(
+    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+{
+    return c+ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)];
+}
+<%
+        break;
+
+      case "numeric":
+%>
+ * @return Value of UCD property '**<%- property %>**'.
+ *
+ * @see MINIUCD_<%- PROPERTY %>
+ */
+const char *
+MiniUCD_GetProperty_<%- Property %>(
+    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+{
+    return ucdAtoms_<%- property %>[ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)]];
+}
+<%
+        break;
+
+      case "string":
+%>
+ * @return Value of UCD property '**<%- property %>**'.
+ *
+ * @see MINIUCD_<%- PROPERTY %>
+ */
+const char *
+MiniUCD_GetProperty_<%- Property %>(
+    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+{
+    return ucdAtoms_<%- property %>[ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)]];
+}
+<%
+        break;
+
+      case "mcp":
+%>
+ * @return Beginning of value list for UCD property '**<%- property %>**'.
+ *
+ * If list length is 1, the first entry gives the offset from the input
+ * codepoint to get the actual single-value codepoint. Else, list entries give
+ * codepoint values that can be safely cast to MiniUCD_Char.
+ *
+ * @see MINIUCD_<%- PROPERTY %>
+ */
+const int *
+MiniUCD_GetProperty_<%- Property %>(
+    MiniUCD_Char c, /*!< Codepoint to get UCD property value for. */
+
+    /*! [out] Value list length. */
+    size_t *lengthPtr)
+{
+    const int *first = ucdAtoms_<%- property %> + ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)],
+        *last = first;
+    while (*last != 0) last++;
+    *lengthPtr = last-first;
+    return first;
+}
+<%
+        break;
+
+      case "enumList":
+        const elementProperty = info.enumType;
+        const ElementProperty = capitalize(elementProperty);
+        const nbValues = properties[elementProperty]?.values?.length || 0;
+        const valueType = nbValues < 256 ? "char" : nbValues < 65536 ? "short" : "int";
+%>
+ * @return Beginning of value list for UCD property '**<%- property %>**'.
+ *
+ * Entries can be safely cast to #MiniUCD_<%- ElementProperty %>.
+ *
+ * @see MINIUCD_<%- PROPERTY %>
+ * @see MiniUCD_<%- ElementProperty %>
+ */
+const unsigned <%- valueType %> *
+MiniUCD_GetProperty_<%- Property %>(
+    MiniUCD_Char c, /*!< Codepoint to get UCD property value for. */
+
+    /*! [out] Value list length. */
+    size_t *lengthPtr)
+{
+    const unsigned <%- valueType %>
+        *first = ucdAtoms_<%- property %> + ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)],
+        *last = first;
+    while (*last != 0) last++;
+    *lengthPtr = last-first;
+    return first;
+}
+<%
+        break;
+    }
+  }
+%>
+/* End of UCD Property Accessors */
+
+
+/*******************************************************************************
+ * Text Segmentation
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Apply a segmentation state machine entry for the codepoint at the given
+ * index.
+ *
+ * @return Number of boundaries found (at most 2).
+ *
+ * @see UCD_SEGMENT_BREAK
+ * @see UCD_SEGMENT_DEFER
+ * @see UCD_SEGMENT_BREAK_DEFERRED
+ */
+static int
+miniucdSegmentStep(
+    unsigned short entry, /*!< State machine entry. */
+    size_t index,         /*!< Index of current codepoint. */
+    size_t *deferredPtr,  /*!< [in,out] Index of deferred boundary. */
+    size_t *boundaries)   /*!< [out] Boundary indices. */
+{
+    int nb = 0;
+    if (entry & UCD_SEGMENT_BREAK_DEFERRED) boundaries[nb++] = *deferredPtr;
+    if (entry & UCD_SEGMENT_DEFER) *deferredPtr = index;
+    else if (entry & UCD_SEGMENT_BREAK) boundaries[nb++] = index;
+    return nb;
+}
+
+/**
+ * Get grapheme break class for given codepoint.
+ *
+ * @return Grapheme break class.
+ *
+ * @see ucdValues_graphemeBreak
+ */
+static int
+miniucdGetGraphemeBreakClass(
+    MiniUCD_Char c,              /*!< Codepoint to get class for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdAscii_graphemeBreak[c];
+    return ucdValues_graphemeBreak[miniucdGetRangeCursor(c, ucdRanges_graphemeBreak, UCD_NBRANGES_GRAPHEMEBREAK, cursor)];
+}
+
+/**
+ * Get word break class for given codepoint.
+ *
+ * @return Word break class.
+ *
+ * @see ucdValues_wordBreak
+ */
+static int
+miniucdGetWordBreakClass(
+    MiniUCD_Char c,              /*!< Codepoint to get class for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdAscii_wordBreak[c];
+    return ucdValues_wordBreak[miniucdGetRangeCursor(c, ucdRanges_wordBreak, UCD_NBRANGES_WORDBREAK, cursor)];
+}
+
+/**
+ * Get sentence break class for given codepoint.
+ *
+ * @return Value of UCD property '**SB**'.
+ *
+ * @see MiniUCD_GetProperty_SB
+ */
+static MiniUCD_SB
+miniucdGetSentenceBreakClass(
+    MiniUCD_Char c,              /*!< Codepoint to get class for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdAscii_SB[c];
+    return ucdValues_SB[miniucdGetRangeCursor(c, ucdRanges_SB, UCD_NBRANGES_SB, cursor)];
+}
+
+/**
+ * Get line break class for given codepoint.
+ *
+ * @return Line break class.
+ *
+ * @see ucdValues_lineBreak
+ * @see MINIUCD_LINEBREAK_AMBIGUOUS_WIDE
+ * @see MINIUCD_LINEBREAK_CJ_AS_ID
+ */
+static int
+miniucdGetLineBreakClass(
+    MiniUCD_Char c,              /*!< Codepoint to get class for. */
+    int options,                 /*!< Line breaking options. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    int cls;
+    if (c < 0x80) return ucdAscii_lineBreak[c];
+    cls = ucdValues_lineBreak[miniucdGetRangeCursor(c, ucdRanges_lineBreak, UCD_NBRANGES_LINEBREAK, cursor)];
+    if (!options) return cls;
+    switch (cls) {
+    case UCD_LINEBREAK_AI:
+    case UCD_LINEBREAK_AI_EA:
+        if (options & MINIUCD_LINEBREAK_AMBIGUOUS_WIDE) return UCD_LINEBREAK_ID_EA;
+        break;
+
+    case UCD_LINEBREAK_CJ_EA:
+        if (options & MINIUCD_LINEBREAK_CJ_AS_ID) return UCD_LINEBREAK_ID_EA;
+        break;
+    }
+    return cls;
+}
+
+/**
+ * Get Indic syllable class for given codepoint.
+ *
+ * @return Syllable break class.
+ *
+ * @see ucdValues_syllableBreak
+ */
+static int
+miniucdGetSyllableBreakClass(
+    MiniUCD_Char c,              /*!< Codepoint to get class for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdAscii_syllableBreak[c];
+    return ucdValues_syllableBreak[miniucdGetRangeCursor(c, ucdRanges_syllableBreak, UCD_NBRANGES_SYLLABLEBREAK, cursor)];
+}
+
+/**
+ * Apply a line breaking state machine entry for the codepoint at the given
+ * index.
+ *
+ * @return Number of breaks found (at most 2).
+ *
+ * @see miniucdSegmentStep
+ * @see UCD_SEGMENT_MANDATORY
+ */
+static int
+miniucdLineBreakStep(
+    unsigned short entry,      /*!< State machine entry. */
+    size_t index,              /*!< Index of current codepoint. */
+    size_t *deferredPtr,       /*!< [in,out] Index of deferred break. */
+    MiniUCD_LineBreak *breaks) /*!< [out] Breaks. */
+{
+    int nb = 0;
+    if (entry & UCD_SEGMENT_BREAK_DEFERRED) {
+        breaks[nb].index = *deferredPtr;
+        breaks[nb++].mandatory = 0;
+    }
+    if (entry & UCD_SEGMENT_DEFER) *deferredPtr = index;
+    else if (entry & UCD_SEGMENT_BREAK) {
+        breaks[nb].index = index;
+        breaks[nb++].mandatory = (entry & UCD_SEGMENT_MANDATORY) != 0;
+    }
+    return nb;
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Initialize grapheme cluster boundary iterator at the start of text.
+ *
+ * @see MiniUCD_GraphemeBreakIterator
+ */
+void
+MiniUCD_GraphemeBreakInit(
+    MiniUCD_GraphemeBreakIterator *it) /*!< Iterator to initialize. */
+{
+    it->state = UCD_GRAPHEMEBREAK_INITIAL;
+    it->index = 0;
+    it->cursor.first = 1;
+    it->cursor.last = 0;
+    it->cursor.index = 0;
+}
+
+/**
+ * Feed the next codepoint to the grapheme cluster boundary iterator.
+ *
+ * A boundary at index *i* lies before the *i*-th codepoint of the stream; the
+ * start of text gives a boundary at index 0, reported along with the first
+ * codepoint.
+ *
+ * @return Number of boundaries found (at most 1): the boundary before this
+ *         codepoint if any.
+ *
+ * @see MiniUCD_GraphemeBreakIterator
+ */
+int
+MiniUCD_GraphemeBreakPush(
+    MiniUCD_GraphemeBreakIterator *it, /*!< Iterator. */
+    MiniUCD_Char c,                    /*!< Next codepoint. */
+
+    /*! [out] Boundary indices, must have room for 1 entry. */
+    size_t *boundaries)
+{
+    unsigned short entry = ucdStates_graphemeBreak[it->state][miniucdGetGraphemeBreakClass(c, &it->cursor)];
+    it->state = entry & UCD_SEGMENT_STATE;
+    if (!(entry & UCD_SEGMENT_BREAK)) {
+        it->index++;
+        return 0;
+    }
+    boundaries[0] = it->index++;
+    return 1;
+}
+
+/**
+ * Feed a buffer of codepoints to the grapheme cluster boundary iterator.
+ *
+ * This is equivalent to calling MiniUCD_GraphemeBreakPush() for each
+ * codepoint, but faster.
+ *
+ * @return Number of boundaries found.
+ *
+ * @see MiniUCD_GraphemeBreakIterator
+ */
+size_t
+MiniUCD_GraphemeBreakFeed(
+    MiniUCD_GraphemeBreakIterator *it, /*!< Iterator. */
+    const MiniUCD_Char *text,          /*!< Codepoints to feed. */
+    size_t length,                     /*!< Number of codepoints to feed. */
+
+    /*! [out] Boundary indices, must have room for **length** entries. */
+    size_t *boundaries)
+{
+    size_t nb = 0, i;
+    int state = it->state;
+    for (i = 0; i < length; i++) {
+        unsigned short entry = ucdStates_graphemeBreak[state][miniucdGetGraphemeBreakClass(text[i], &it->cursor)];
+        state = entry & UCD_SEGMENT_STATE;
+        if (entry & UCD_SEGMENT_BREAK) boundaries[nb++] = it->index+i;
+    }
+    it->state = state;
+    it->index += length;
+    return nb;
+}
+
+/**
+ * Signal the end of text to the grapheme cluster boundary iterator.
+ *
+ * The iterator is reset afterwards and can be reused for a new text.
+ *
+ * @return Number of boundaries found (at most 1): the end of text.
+ *
+ * @see MiniUCD_GraphemeBreakIterator
+ */
+int
+MiniUCD_GraphemeBreakEnd(
+    MiniUCD_GraphemeBreakIterator *it, /*!< Iterator. */
+
+    /*! [out] Boundary indices, must have room for 1 entry. */
+    size_t *boundaries)
+{
+    unsigned short entry = ucdStates_graphemeBreak[it->state][UCD_GRAPHEMEBREAK_NBCLASSES];
+    int nb = 0;
+    if (entry & UCD_SEGMENT_BREAK) boundaries[nb++] = it->index;
+    MiniUCD_GraphemeBreakInit(it);
+    return nb;
+}
+
+/**
+ * Initialize word boundary iterator at the start of text.
+ *
+ * @see MiniUCD_WordBreakIterator
+ */
+void
+MiniUCD_WordBreakInit(
+    MiniUCD_WordBreakIterator *it) /*!< Iterator to initialize. */
+{
+    it->state = UCD_WORDBREAK_INITIAL;
+    it->index = 0;
+    it->deferred = 0;
+    it->cursor.first = 1;
+    it->cursor.last = 0;
+    it->cursor.index = 0;
+}
+
+/**
+ * Feed the next codepoint to the word boundary iterator.
+ *
+ * Reported boundaries are in increasing order. A boundary at index *i* lies
+ * before the *i*-th codepoint of the stream; the start of text gives a
+ * boundary at index 0, reported along with the first codepoint.
+ *
+ * @return Number of boundaries found (at most 2): the deferred boundary
+ *         confirmed by this codepoint if any, then the boundary before it if
+ *         known at this point.
+ *
+ * @see MiniUCD_WordBreakIterator
+ */
+int
+MiniUCD_WordBreakPush(
+    MiniUCD_WordBreakIterator *it, /*!< Iterator. */
+    MiniUCD_Char c,                /*!< Next codepoint. */
+
+    /*! [out] Boundary indices, must have room for 2 entries. */
+    size_t *boundaries)
+{
+    unsigned short entry = ucdStates_wordBreak[it->state][miniucdGetWordBreakClass(c, &it->cursor)];
+    it->state = entry & UCD_SEGMENT_STATE;
+    return miniucdSegmentStep(entry, it->index++, &it->deferred, boundaries);
+}
+
+/**
+ * Feed a buffer of codepoints to the word boundary iterator.
+ *
+ * This is equivalent to calling MiniUCD_WordBreakPush() for each codepoint,
+ * but faster.
+ *
+ * @return Number of boundaries found.
+ *
+ * @see MiniUCD_WordBreakIterator
+ */
+size_t
+MiniUCD_WordBreakFeed(
+    MiniUCD_WordBreakIterator *it, /*!< Iterator. */
+    const MiniUCD_Char *text,      /*!< Codepoints to feed. */
+    size_t length,                 /*!< Number of codepoints to feed. */
+
+    /*! [out] Boundary indices, must have room for **length+1** entries. */
+    size_t *boundaries)
+{
+    size_t nb = 0, i;
+    int state = it->state;
+    for (i = 0; i < length; i++) {
+        unsigned short entry = ucdStates_wordBreak[state][miniucdGetWordBreakClass(text[i], &it->cursor)];
+        state = entry & UCD_SEGMENT_STATE;
+        nb += miniucdSegmentStep(entry, it->index+i, &it->deferred, boundaries+nb);
+    }
+    it->state = state;
+    it->index += length;
+    return nb;
+}
+
+/**
+ * Signal the end of text to the word boundary iterator.
+ *
+ * The iterator is reset afterwards and can be reused for a new text.
+ *
+ * @return Number of boundaries found (at most 2): the deferred boundary if
+ *         any, then the end of text.
+ *
+ * @see MiniUCD_WordBreakIterator
+ */
+int
+MiniUCD_WordBreakEnd(
+    MiniUCD_WordBreakIterator *it, /*!< Iterator. */
+
+    /*! [out] Boundary indices, must have room for 2 entries. */
+    size_t *boundaries)
+{
+    unsigned short entry = ucdStates_wordBreak[it->state][UCD_WORDBREAK_NBCLASSES];
+    int nb = miniucdSegmentStep(entry, it->index, &it->deferred, boundaries);
+    MiniUCD_WordBreakInit(it);
+    return nb;
+}
+
+/**
+ * Initialize sentence boundary iterator at the start of text.
+ *
+ * @see MiniUCD_SentenceBreakIterator
+ */
+void
+MiniUCD_SentenceBreakInit(
+    MiniUCD_SentenceBreakIterator *it) /*!< Iterator to initialize. */
+{
+    it->state = UCD_SENTENCEBREAK_INITIAL;
+    it->index = 0;
+    it->deferred = 0;
+    it->cursor.first = 1;
+    it->cursor.last = 0;
+    it->cursor.index = 0;
+}
+
+/**
+ * Feed the next codepoint to the sentence boundary iterator.
+ *
+ * Reported boundaries are in increasing order. A boundary at index *i* lies
+ * before the *i*-th codepoint of the stream; the start of text gives a
+ * boundary at index 0, reported along with the first codepoint.
+ *
+ * @return Number of boundaries found (at most 2): the deferred boundary
+ *         confirmed by this codepoint if any, then the boundary before it if
+ *         known at this point.
+ *
+ * @see MiniUCD_SentenceBreakIterator
+ */
+int
+MiniUCD_SentenceBreakPush(
+    MiniUCD_SentenceBreakIterator *it, /*!< Iterator. */
+    MiniUCD_Char c,                    /*!< Next codepoint. */
+
+    /*! [out] Boundary indices, must have room for 2 entries. */
+    size_t *boundaries)
+{
+    unsigned short entry = ucdStates_sentenceBreak[it->state][miniucdGetSentenceBreakClass(c, &it->cursor)];
+    it->state = entry & UCD_SEGMENT_STATE;
+    return miniucdSegmentStep(entry, it->index++, &it->deferred, boundaries);
+}
+
+/**
+ * Feed a buffer of codepoints to the sentence boundary iterator.
+ *
+ * This is equivalent to calling MiniUCD_SentenceBreakPush() for each
+ * codepoint, but faster.
+ *
+ * @return Number of boundaries found.
+ *
+ * @see MiniUCD_SentenceBreakIterator
+ */
+size_t
+MiniUCD_SentenceBreakFeed(
+    MiniUCD_SentenceBreakIterator *it, /*!< Iterator. */
+    const MiniUCD_Char *text,          /*!< Codepoints to feed. */
+    size_t length,                     /*!< Number of codepoints to feed. */
+
+    /*! [out] Boundary indices, must have room for **length+1** entries. */
+    size_t *boundaries)
+{
+    size_t nb = 0, i;
+    int state = it->state;
+    for (i = 0; i < length; i++) {
+        unsigned short entry = ucdStates_sentenceBreak[state][miniucdGetSentenceBreakClass(text[i], &it->cursor)];
+        state = entry & UCD_SEGMENT_STATE;
+        nb += miniucdSegmentStep(entry, it->index+i, &it->deferred, boundaries+nb);
+    }
+    it->state = state;
+    it->index += length;
+    return nb;
+}
+
+/**
+ * Signal the end of text to the sentence boundary iterator.
+ *
+ * The iterator is reset afterwards and can be reused for a new text.
+ *
+ * @return Number of boundaries found (at most 2): the deferred boundary if
+ *         any, then the end of text.
+ *
+ * @see MiniUCD_SentenceBreakIterator
+ */
+int
+MiniUCD_SentenceBreakEnd(
+    MiniUCD_SentenceBreakIterator *it, /*!< Iterator. */
+
+    /*! [out] Boundary indices, must have room for 2 entries. */
+    size_t *boundaries)
+{
+    unsigned short entry = ucdStates_sentenceBreak[it->state][0];
+    int nb = miniucdSegmentStep(entry, it->index, &it->deferred, boundaries);
+    MiniUCD_SentenceBreakInit(it);
+    return nb;
+}
+
+/**
+ * Initialize line breaking iterator at the start of text.
+ *
+ * @see MiniUCD_LineBreakIterator
+ * @see MINIUCD_LINEBREAK_AMBIGUOUS_WIDE
+ * @see MINIUCD_LINEBREAK_CJ_AS_ID
+ */
+void
+MiniUCD_LineBreakInit(
+    MiniUCD_LineBreakIterator *it, /*!< Iterator to initialize. */
+    int options)                   /*!< Line breaking options. */
+{
+    it->state = UCD_LINEBREAK_INITIAL;
+    it->options = options;
+    it->index = 0;
+    it->deferred = 0;
+    it->cursor.first = 1;
+    it->cursor.last = 0;
+    it->cursor.index = 0;
+}
+
+/**
+ * Feed the next codepoint to the line breaking iterator.
+ *
+ * Reported breaks are in increasing order. A break at index *i* lies before
+ * the *i*-th codepoint of the stream; there is never a break at the start of
+ * text (LB2).
+ *
+ * @return Number of breaks found (at most 2): the deferred break confirmed by
+ *         this codepoint if any, then the break before it if known at this
+ *         point.
+ *
+ * @see MiniUCD_LineBreakIterator
+ */
+int
+MiniUCD_LineBreakPush(
+    MiniUCD_LineBreakIterator *it, /*!< Iterator. */
+    MiniUCD_Char c,                /*!< Next codepoint. */
+
+    /*! [out] Breaks, must have room for 2 entries. */
+    MiniUCD_LineBreak *breaks)
+{
+    unsigned short entry = ucdStates_lineBreak[it->state][miniucdGetLineBreakClass(c, it->options, &it->cursor)];
+    it->state = entry & UCD_SEGMENT_STATE;
+    return miniucdLineBreakStep(entry, it->index++, &it->deferred, breaks);
+}
+
+/**
+ * Feed a buffer of codepoints to the line breaking iterator.
+ *
+ * This is equivalent to calling MiniUCD_LineBreakPush() for each codepoint,
+ * but faster.
+ *
+ * @return Number of breaks found.
+ *
+ * @see MiniUCD_LineBreakIterator
+ */
+size_t
+MiniUCD_LineBreakFeed(
+    MiniUCD_LineBreakIterator *it, /*!< Iterator. */
+    const MiniUCD_Char *text,      /*!< Codepoints to feed. */
+    size_t length,                 /*!< Number of codepoints to feed. */
+
+    /*! [out] Breaks, must have room for **length+1** entries. */
+    MiniUCD_LineBreak *breaks)
+{
+    size_t nb = 0, i;
+    int state = it->state;
+    for (i = 0; i < length; i++) {
+        unsigned short entry = ucdStates_lineBreak[state][miniucdGetLineBreakClass(text[i], it->options, &it->cursor)];
+        state = entry & UCD_SEGMENT_STATE;
+        nb += miniucdLineBreakStep(entry, it->index+i, &it->deferred, breaks+nb);
+    }
+    it->state = state;
+    it->index += length;
+    return nb;
+}
+
+/**
+ * Signal the end of text to the line breaking iterator.
+ *
+ * The end of a non-empty text is a mandatory break (LB3). The iterator is
+ * reset afterwards and can be reused for a new text with the same options.
+ *
+ * @return Number of breaks found (at most 2): the deferred break if any, then
+ *         the end of text.
+ *
+ * @see MiniUCD_LineBreakIterator
+ */
+int
+MiniUCD_LineBreakEnd(
+    MiniUCD_LineBreakIterator *it, /*!< Iterator. */
+
+    /*! [out] Breaks, must have room for 2 entries. */
+    MiniUCD_LineBreak *breaks)
+{
+    unsigned short entry = ucdStates_lineBreak[it->state][UCD_LINEBREAK_NBCLASSES];
+    int nb = miniucdLineBreakStep(entry, it->index, &it->deferred, breaks);
+    MiniUCD_LineBreakInit(it, it->options);
+    return nb;
+}
+
+/**
+ * Tell whether two line breaking iterators are in the same state, relative
+ * to their current index.
+ *
+ * Iterators in the same state report the same breaks for the same input,
+ * shifted by the difference of their indices. This is used to stop
+ * re-wrapping after an edit once the text past the edit gives the same
+ * breaks as before.
+ *
+ * @return Nonzero if both iterators are in the same state.
+ *
+ * @see MiniUCD_LineBreakIterator
+ */
+int
+MiniUCD_LineBreakSameState(
+    const MiniUCD_LineBreakIterator *it1, /*!< First iterator. */
+    const MiniUCD_LineBreakIterator *it2) /*!< Second iterator. */
+{
+    if (it1->state != it2->state || it1->options != it2->options) return 0;
+    if (it1->state < UCD_LINEBREAK_PENDING) return 1;
+    return (it1->index - it1->deferred == it2->index - it2->deferred);
+}
+
+/**
+ * Tell whether two codepoints of a syllable belong to the same script.
+ * Common and inherited characters belong to any script.
+ *
+ * @return Nonzero if same script.
+ */
+static int
+miniucdSameScript(
+    MiniUCD_Char c1, /*!< First codepoint. */
+    MiniUCD_Char c2) /*!< Second codepoint. */
+{
+    MiniUCD_Sc sc1 = MiniUCD_GetProperty_Sc(c1);
+    MiniUCD_Sc sc2 = MiniUCD_GetProperty_Sc(c2);
+    return (sc1 == sc2
+        || sc1 == MINIUCD_SC_ZYYY || sc1 == MINIUCD_SC_ZINH
+        || sc2 == MINIUCD_SC_ZYYY || sc2 == MINIUCD_SC_ZINH);
+}
+
+/**
+ * Initialize Indic syllable boundary iterator at the start of text.
+ *
+ * @see MiniUCD_SyllableBreakIterator
+ */
+void
+MiniUCD_SyllableBreakInit(
+    MiniUCD_SyllableBreakIterator *it) /*!< Iterator to initialize. */
+{
+    it->state = UCD_SYLLABLEBREAK_INITIAL;
+    it->base = 0;
+    MiniUCD_GraphemeBreakInit(&it->grapheme);
+    it->cursor.first = 1;
+    it->cursor.last = 0;
+    it->cursor.index = 0;
+}
+
+/**
+ * Feed the next codepoint to the Indic syllable boundary iterator.
+ *
+ * @return Number of boundaries found (at most 1): the boundary before this
+ *         codepoint if any.
+ *
+ * @see MiniUCD_SyllableBreakIterator
+ * @see MiniUCD_GraphemeBreakPush
+ */
+int
+MiniUCD_SyllableBreakPush(
+    MiniUCD_SyllableBreakIterator *it, /*!< Iterator. */
+    MiniUCD_Char c,                    /*!< Next codepoint. */
+
+    /*! [out] Boundary indices, must have room for 1 entry. */
+    size_t *boundaries)
+{
+    unsigned short entry = ucdStates_syllableBreak[it->state][miniucdGetSyllableBreakClass(c, &it->cursor)];
+    it->state = entry & UCD_SEGMENT_STATE;
+    if ((entry & UCD_SEGMENT_SAME_SCRIPT) && !miniucdSameScript(it->base, c)) {
+        entry |= UCD_SEGMENT_BREAK;
+    }
+    if (entry & UCD_SEGMENT_BREAK) it->base = c;
+
+    /* Only keep boundaries between grapheme clusters. */
+    if (!MiniUCD_GraphemeBreakPush(&it->grapheme, c, boundaries)) return 0;
+    return (entry & UCD_SEGMENT_BREAK) ? 1 : 0;
+}
+
+/**
+ * Feed a buffer of codepoints to the Indic syllable boundary iterator.
+ *
+ * This is equivalent to calling MiniUCD_SyllableBreakPush() for each
+ * codepoint.
+ *
+ * @return Number of boundaries found.
+ *
+ * @see MiniUCD_SyllableBreakIterator
+ */
+size_t
+MiniUCD_SyllableBreakFeed(
+    MiniUCD_SyllableBreakIterator *it, /*!< Iterator. */
+    const MiniUCD_Char *text,          /*!< Codepoints to feed. */
+    size_t length,                     /*!< Number of codepoints to feed. */
+
+    /*! [out] Boundary indices, must have room for **length** entries. */
+    size_t *boundaries)
+{
+    size_t nb = 0, i;
+    for (i = 0; i < length; i++) {
+        nb += MiniUCD_SyllableBreakPush(it, text[i], boundaries+nb);
+    }
+    return nb;
+}
+
+/**
+ * Signal the end of text to the Indic syllable boundary iterator.
+ *
+ * The iterator is reset afterwards and can be reused for a new text.
+ *
+ * @return Number of boundaries found (at most 1): the end of text.
+ *
+ * @see MiniUCD_SyllableBreakIterator
+ */
+int
+MiniUCD_SyllableBreakEnd(
+    MiniUCD_SyllableBreakIterator *it, /*!< Iterator. */
+
+    /*! [out] Boundary indices, must have room for 1 entry. */
+    size_t *boundaries)
+{
+    unsigned short entry = ucdStates_syllableBreak[it->state][UCD_SYLLABLEBREAK_NBCLASSES];
+    int nb = MiniUCD_GraphemeBreakEnd(&it->grapheme, boundaries);
+    if (!(entry & UCD_SEGMENT_BREAK)) nb = 0;
+    MiniUCD_SyllableBreakInit(it);
+    return nb;
+}
+
+/* End of Text Segmentation */
+
+
+/*******************************************************************************
+ * Bidirectional Algorithm
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/** Bit mask for Bidi_Class value. */
+#define UCD_BIDI_BIT(bc)        (1UL << (bc))
+
+/** Right-to-left and explicit formatting classes. */
+#define UCD_BIDI_RTL_MASK       (UCD_BIDI_BIT(MINIUCD_BC_R) | UCD_BIDI_BIT(MINIUCD_BC_AL) \
+                                | UCD_BIDI_BIT(MINIUCD_BC_AN) | UCD_BIDI_EXPLICIT_MASK \
+                                | UCD_BIDI_ISOLATE_MASK | UCD_BIDI_BIT(MINIUCD_BC_PDI))
+
+/** Explicit embedding and override classes, removed by rule X9. */
+#define UCD_BIDI_EXPLICIT_MASK  (UCD_BIDI_BIT(MINIUCD_BC_LRE) | UCD_BIDI_BIT(MINIUCD_BC_RLE) \
+                                | UCD_BIDI_BIT(MINIUCD_BC_LRO) | UCD_BIDI_BIT(MINIUCD_BC_RLO) \
+                                | UCD_BIDI_BIT(MINIUCD_BC_PDF))
+
+/** Isolate initiator classes. */
+#define UCD_BIDI_ISOLATE_MASK   (UCD_BIDI_BIT(MINIUCD_BC_LRI) | UCD_BIDI_BIT(MINIUCD_BC_RLI) \
+                                | UCD_BIDI_BIT(MINIUCD_BC_FSI))
+
+/** Neutral and isolate classes (NI), for rules N1 and N2. */
+#define UCD_BIDI_NI_MASK        (UCD_BIDI_BIT(MINIUCD_BC_B) | UCD_BIDI_BIT(MINIUCD_BC_S) \
+                                | UCD_BIDI_BIT(MINIUCD_BC_WS) | UCD_BIDI_BIT(MINIUCD_BC_ON) \
+                                | UCD_BIDI_ISOLATE_MASK | UCD_BIDI_BIT(MINIUCD_BC_PDI))
+
+/** Classes reset to paragraph level before separators and line ends (L1). */
+#define UCD_BIDI_TRAILING_MASK  (UCD_BIDI_BIT(MINIUCD_BC_WS) | UCD_BIDI_ISOLATE_MASK \
+                                | UCD_BIDI_BIT(MINIUCD_BC_PDI) | UCD_BIDI_BIT(MINIUCD_BC_BN) \
+                                | UCD_BIDI_EXPLICIT_MASK)
+
+/** Test Bidi_Class value against mask. */
+#define UCD_BIDI_IS(bc, mask)   ((UCD_BIDI_BIT(bc) & (mask)) != 0)
+
+/** Maximum nesting of bracket pairs (BD16). */
+#define UCD_BIDI_MAX_BRACKETS   63
+
+/**
+ * Get Bidi_Class value for given codepoint.
+ *
+ * @return Value of UCD property '**bc**'.
+ *
+ * @see MiniUCD_GetProperty_Bc
+ */
+static MiniUCD_Bc
+miniucdGetBidiClass(
+    MiniUCD_Char c,              /*!< Codepoint to get class for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdAscii_bc[c];
+    return ucdValues_bc[miniucdGetRangeCursor(c, ucdRanges_bc, UCD_NBRANGES_BC, cursor)];
+}
+
+/**
+ * Find direction of first strong character, skipping isolates (rules P2, P3).
+ *
+ * @return 1 for R or AL, 0 for L, else default level.
+ */
+static int
+miniucdBidiFirstStrong(
+    const unsigned char *types, /*!< Bidi classes. */
+    const size_t *matching,     /*!< Matching PDIs of isolate initiators. */
+    size_t start,               /*!< Index of first character. */
+    size_t end,                 /*!< Index past last character. */
+    int level)                  /*!< Default level. */
+{
+    size_t i;
+    for (i = start; i < end; i++) {
+        switch (types[i]) {
+        case MINIUCD_BC_L: return 0;
+        case MINIUCD_BC_R:
+        case MINIUCD_BC_AL: return 1;
+        case MINIUCD_BC_B: return level;
+        case MINIUCD_BC_LRI:
+        case MINIUCD_BC_RLI:
+        case MINIUCD_BC_FSI:
+            if (matching[i] >= end) return level;
+            i = matching[i];
+            break;
+        }
+    }
+    return level;
+}
+
+/**
+ * Get canonical form of opening paired bracket for given bracket, so that
+ * canonically equivalent brackets match (BD16).
+ *
+ * @return Canonical opening bracket.
+ */
+static MiniUCD_Char
+miniucdBidiBracket(
+    MiniUCD_Char c) /*!< Opening or closing paired bracket. */
+{
+    if (MiniUCD_GetProperty_Bpt(c) == MINIUCD_BPT_C) c = MiniUCD_GetProperty_Bpb(c);
+    return (c == 0x2329 ? 0x3008 : c);
+}
+
+/**
+ * Resolve weak and neutral types of an isolating run sequence (rules W1-W7,
+ * N0-N2).
+ */
+static void
+miniucdBidiResolveSequence(
+    const MiniUCD_Char *text,     /*!< Paragraph text. */
+    const size_t *seq,            /*!< Text indices of sequence characters. */
+    size_t length,                /*!< Sequence length. */
+    unsigned char *types,         /*!< [in,out] Bidi classes. */
+    const unsigned char *orig,    /*!< Original Bidi classes. */
+    size_t *pairs,                /*!< Scratch buffer of **length** entries. */
+    const unsigned char *levels,  /*!< Embedding levels. */
+    int sos,                      /*!< Start-of-sequence type (L or R). */
+    int eos)                      /*!< End-of-sequence type (L or R). */
+{
+    struct {
+        MiniUCD_Char bracket;
+        size_t index;
+    } brackets[UCD_BIDI_MAX_BRACKETS];
+    int level = levels[seq[0]], e = (level & 1) ? MINIUCD_BC_R : MINIUCD_BC_L;
+    int nbBrackets = 0, strong, t;
+    size_t k, j, end;
+
+#define T(k) types[seq[k]]
+#define STRONG(t) ((t) == MINIUCD_BC_L ? MINIUCD_BC_L \
+        : ((t) == MINIUCD_BC_R || (t) == MINIUCD_BC_EN || (t) == MINIUCD_BC_AN) ? MINIUCD_BC_R : 0)
+
+    /* W1 */
+    for (k = 0; k < length; k++) {
+        if (T(k) != MINIUCD_BC_NSM) continue;
+        if (k == 0) T(k) = sos;
+        else if (UCD_BIDI_IS(orig[seq[k-1]], UCD_BIDI_ISOLATE_MASK | UCD_BIDI_BIT(MINIUCD_BC_PDI))) T(k) = MINIUCD_BC_ON;
+        else T(k) = T(k-1);
+    }
+
+    /* W2, W3 */
+    for (k = 0, strong = sos; k < length; k++) {
+        t = T(k);
+        if (t == MINIUCD_BC_L || t == MINIUCD_BC_R || t == MINIUCD_BC_AL) strong = t;
+        if (t == MINIUCD_BC_EN && strong == MINIUCD_BC_AL) T(k) = MINIUCD_BC_AN;
+        if (t == MINIUCD_BC_AL) T(k) = MINIUCD_BC_R;
+    }
+
+    /* W4 */
+    for (k = 1; k+1 < length; k++) {
+        t = T(k);
+        if ((t == MINIUCD_BC_ES || t == MINIUCD_BC_CS) && T(k-1) == MINIUCD_BC_EN && T(k+1) == MINIUCD_BC_EN) T(k) = MINIUCD_BC_EN;
+        else if (t == MINIUCD_BC_CS && T(k-1) == MINIUCD_BC_AN && T(k+1) == MINIUCD_BC_AN) T(k) = MINIUCD_BC_AN;
+    }
+
+    /* W5 */
+    for (k = 0; k < length; k = end) {
+        for (end = k; end < length && T(end) == MINIUCD_BC_ET; end++);
+        if (end == k) {
+            end++;
+            continue;
+        }
+        if ((k > 0 && T(k-1) == MINIUCD_BC_EN) || (end < length && T(end) == MINIUCD_BC_EN)) {
+            for (j = k; j < end; j++) T(j) = MINIUCD_BC_EN;
+        }
+    }
+
+    /* W6, W7 */
+    for (k = 0, strong = sos; k < length; k++) {
+        t = T(k);
+        if (t == MINIUCD_BC_ES || t == MINIUCD_BC_ET || t == MINIUCD_BC_CS) T(k) = MINIUCD_BC_ON;
+        if (t == MINIUCD_BC_L || t == MINIUCD_BC_R) strong = t;
+        if (t == MINIUCD_BC_EN && strong == MINIUCD_BC_L) T(k) = MINIUCD_BC_L;
+    }
+
+    /* BD16: identify bracket pairs; pairs[k] is the closing bracket of the
+     * opening one at k, if any. */
+    for (k = 0; k < length; k++) pairs[k] = length;
+    for (k = 0; k < length; k++) {
+        MiniUCD_Char c = text[seq[k]];
+        MiniUCD_Bpt bpt;
+        int i;
+        if (T(k) != MINIUCD_BC_ON) continue;
+        bpt = MiniUCD_GetProperty_Bpt(c);
+        if (bpt == MINIUCD_BPT_O) {
+            if (nbBrackets == UCD_BIDI_MAX_BRACKETS) break;
+            brackets[nbBrackets].bracket = miniucdBidiBracket(c);
+            brackets[nbBrackets++].index = k;
+        } else if (bpt == MINIUCD_BPT_C) {
+            MiniUCD_Char bracket = miniucdBidiBracket(c);
+            for (i = nbBrackets-1; i >= 0; i--) {
+                if (brackets[i].bracket != bracket) continue;
+                pairs[brackets[i].index] = k;
+                nbBrackets = i;
+                break;
+            }
+        }
+    }
+
+    /* N0 */
+    for (k = 0; k < length; k++) {
+        int found = 0, dir;
+        if (pairs[k] == length) continue;
+        for (j = k+1; j < pairs[k]; j++) {
+            strong = STRONG(T(j));
+            if (strong == e) {
+                found = e;
+                break;
+            }
+            if (strong) found = strong;
+        }
+        if (!found) continue;
+        dir = e;
+        if (found != e) {
+            /* Opposite direction inside, check context before. */
+            for (j = k, strong = 0; j > 0 && !strong; j--) strong = STRONG(T(j-1));
+            if ((strong ? strong : sos) == found) dir = found;
+        }
+        T(k) = T(pairs[k]) = dir;
+        for (j = k+1; j < length && orig[seq[j]] == MINIUCD_BC_NSM; j++) T(j) = dir;
+        for (j = pairs[k]+1; j < length && orig[seq[j]] == MINIUCD_BC_NSM; j++) T(j) = dir;
+    }
+
+    /* N1, N2 */
+    for (k = 0; k < length; k = end) {
+        int before, after;
+        for (end = k; end < length && UCD_BIDI_IS(T(end), UCD_BIDI_NI_MASK); end++);
+        if (end == k) {
+            end++;
+            continue;
+        }
+        before = (k > 0 ? STRONG(T(k-1)) : sos);
+        after = (end < length ? STRONG(T(end)) : eos);
+        for (j = k; j < end; j++) T(j) = (before == after ? before : e);
+    }
+
+#undef T
+#undef STRONG
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Tell whether text is left-to-right only, i.e. has no right-to-left or
+ * explicit formatting character. Such text needs no bidi processing in a
+ * left-to-right paragraph: all levels are 0 and reordering is the identity.
+ *
+ * @return Nonzero if text is left-to-right only.
+ */
+int
+MiniUCD_BidiIsLTR(
+    const MiniUCD_Char *text, /*!< Text to scan. */
+    size_t length)            /*!< Text length. */
+{
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    size_t i;
+    for (i = 0; i < length; i++) {
+        /* No ASCII character is right-to-left. */
+        if (text[i] < 0x80) continue;
+        if (UCD_BIDI_IS(miniucdGetBidiClass(text[i], &cursor), UCD_BIDI_RTL_MASK)) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Get size of arena needed to resolve a paragraph.
+ *
+ * @return Arena size in bytes.
+ *
+ * @see MiniUCD_BidiResolve
+ */
+size_t
+MiniUCD_BidiArenaSize(
+    size_t length) /*!< Paragraph length. */
+{
+    return length * (3*sizeof(size_t) + 2);
+}
+
+/**
+ * Resolve embedding levels of a paragraph (rules P2-P3, X1-X10, W1-W7,
+ * N0-N2, I1-I2 and L1 for separators and the end of the paragraph).
+ *
+ * Text must be a single paragraph, i.e. split at paragraph separators (rule
+ * P1). Characters removed by rule X9 get the level of the preceding
+ * character.
+ *
+ * @return Paragraph embedding level.
+ *
+ * @see MiniUCD_BidiArenaSize
+ * @see MiniUCD_BidiReorder
+ */
+int
+MiniUCD_BidiResolve(
+    const MiniUCD_Char *text, /*!< Paragraph text. */
+    size_t length,            /*!< Paragraph length. */
+
+    /*! Paragraph embedding level (0 or 1), or #MINIUCD_BIDI_AUTO. */
+    int paragraphLevel,
+
+    /*! Working memory, must have room for MiniUCD_BidiArenaSize(**length**)
+     *  bytes, suitably aligned for size_t. */
+    void *arena,
+
+    /*! [out] Embedding levels, must have room for **length** entries. */
+    unsigned char *levels)
+{
+    struct {
+        unsigned char level;
+        unsigned char override;
+        unsigned char isolate;
+    } stack[MINIUCD_BIDI_MAX_DEPTH+2];
+    size_t *matching = (size_t *) arena, *seq = matching+length, *pairs = seq+length;
+    unsigned char *types = (unsigned char *) (pairs+length), *orig = types+length;
+    size_t overflowIsolates = 0, overflowEmbeddings = 0, validIsolates = 0;
+    size_t i, j, k, nb, ws;
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    int depth = 0, level, t;
+
+    /* Fast exit for left-to-right text. */
+    if (paragraphLevel != 1 && MiniUCD_BidiIsLTR(text, length)) {
+        for (i = 0; i < length; i++) levels[i] = 0;
+        return 0;
+    }
+
+    /* BD9: matching isolate initiators and PDIs, using seq as stack. Matched
+     * PDIs point back to their initiator. */
+    for (i = 0, nb = 0; i < length; i++) {
+        types[i] = orig[i] = miniucdGetBidiClass(text[i], &cursor);
+        matching[i] = length;
+        if (UCD_BIDI_IS(types[i], UCD_BIDI_ISOLATE_MASK)) {
+            seq[nb++] = i;
+        } else if (types[i] == MINIUCD_BC_PDI && nb > 0) {
+            nb--;
+            matching[seq[nb]] = i;
+            matching[i] = seq[nb];
+        }
+    }
+
+    /* P2, P3 */
+    if (paragraphLevel == MINIUCD_BIDI_AUTO) {
+        paragraphLevel = miniucdBidiFirstStrong(types, matching, 0, length, 0);
+    }
+
+    /* X1-X8 */
+    stack[0].level = paragraphLevel;
+    stack[0].override = 0;
+    stack[0].isolate = 0;
+    for (i = 0; i < length; i++) {
+        t = types[i];
+        level = stack[depth].level;
+        switch (t) {
+        case MINIUCD_BC_RLE:
+        case MINIUCD_BC_LRE:
+        case MINIUCD_BC_RLO:
+        case MINIUCD_BC_LRO:
+            /* X2-X5 */
+            levels[i] = level;
+            level = (t == MINIUCD_BC_RLE || t == MINIUCD_BC_RLO) ? ((level+1) | 1) : ((level+2) & ~1);
+            if (level <= MINIUCD_BIDI_MAX_DEPTH && !overflowIsolates && !overflowEmbeddings) {
+                depth++;
+                stack[depth].level = level;
+                stack[depth].override = (t == MINIUCD_BC_RLO ? MINIUCD_BC_R : t == MINIUCD_BC_LRO ? MINIUCD_BC_L : 0);
+                stack[depth].isolate = 0;
+            } else if (!overflowIsolates) {
+                overflowEmbeddings++;
+            }
+            break;
+
+        case MINIUCD_BC_RLI:
+        case MINIUCD_BC_LRI:
+        case MINIUCD_BC_FSI:
+            /* X5a-X5c */
+            levels[i] = level;
+            if (stack[depth].override) types[i] = stack[depth].override;
+            if (t == MINIUCD_BC_FSI) {
+                t = miniucdBidiFirstStrong(orig, matching, i+1, matching[i], 0) ? MINIUCD_BC_RLI : MINIUCD_BC_LRI;
+            }
+            level = (t == MINIUCD_BC_RLI) ? ((level+1) | 1) : ((level+2) & ~1);
+            if (level <= MINIUCD_BIDI_MAX_DEPTH && !overflowIsolates && !overflowEmbeddings) {
+                validIsolates++;
+                depth++;
+                stack[depth].level = level;
+                stack[depth].override = 0;
+                stack[depth].isolate = 1;
+            } else {
+                overflowIsolates++;
+            }
+            break;
+
+        case MINIUCD_BC_PDI:
+            /* X6a */
+            if (overflowIsolates) {
+                overflowIsolates--;
+            } else if (validIsolates) {
+                overflowEmbeddings = 0;
+                while (!stack[depth].isolate) depth--;
+                depth--;
+                validIsolates--;
+            }
+            levels[i] = stack[depth].level;
+            if (stack[depth].override) types[i] = stack[depth].override;
+            break;
+
+        case MINIUCD_BC_PDF:
+            /* X7 */
+            levels[i] = level;
+            if (overflowIsolates) {
+                /* Do nothing. */
+            } else if (overflowEmbeddings) {
+                overflowEmbeddings--;
+            } else if (!stack[depth].isolate && depth > 0) {
+                depth--;
+            }
+            break;
+
+        case MINIUCD_BC_B:
+            /* X8 */
+            levels[i] = paragraphLevel;
+            break;
+
+        case MINIUCD_BC_BN:
+            levels[i] = level;
+            break;
+
+        default:
+            /* X6 */
+            levels[i] = level;
+            if (stack[depth].override) types[i] = stack[depth].override;
+        }
+    }
+
+    /* X9: removed characters are marked as BN. */
+    for (i = 0; i < length; i++) {
+        if (UCD_BIDI_IS(orig[i], UCD_BIDI_EXPLICIT_MASK)) types[i] = MINIUCD_BC_BN;
+    }
+
+    /* X10: isolating run sequences. A sequence starts with any level run that
+     * doesn't start with a matched PDI, and continues with the run starting
+     * at the matching PDI as long as the last run ends with an isolate
+     * initiator. */
+    for (i = 0; i < length; i++) {
+        int sos, eos;
+        if (types[i] == MINIUCD_BC_BN) continue;
+        for (j = i; j > 0 && types[j-1] == MINIUCD_BC_BN; j--);
+        if (j > 0 && levels[j-1] == levels[i]) continue;
+        if (orig[i] == MINIUCD_BC_PDI && matching[i] < i) continue;
+
+        /* sos */
+        level = (j > 0 ? levels[j-1] : paragraphLevel);
+        sos = ((level > levels[i] ? level : levels[i]) & 1) ? MINIUCD_BC_R : MINIUCD_BC_L;
+
+        /* Collect level runs. */
+        nb = 0;
+        k = i;
+        for (;;) {
+            level = levels[k];
+            for (; k < length; k++) {
+                if (types[k] == MINIUCD_BC_BN) continue;
+                if (levels[k] != level) break;
+                seq[nb++] = k;
+            }
+            k = seq[nb-1];
+            if (!UCD_BIDI_IS(orig[k], UCD_BIDI_ISOLATE_MASK) || matching[k] == length) break;
+            k = matching[k];
+        }
+
+        /* eos */
+        k = seq[nb-1];
+        if (UCD_BIDI_IS(orig[k], UCD_BIDI_ISOLATE_MASK)) {
+            level = paragraphLevel;
+        } else {
+            for (k++; k < length && types[k] == MINIUCD_BC_BN; k++);
+            level = (k < length ? levels[k] : paragraphLevel);
+        }
+        eos = ((level > levels[i] ? level : levels[i]) & 1) ? MINIUCD_BC_R : MINIUCD_BC_L;
+
+        miniucdBidiResolveSequence(text, seq, nb, types, orig, pairs, levels, sos, eos);
+    }
+
+    /* I1, I2; removed characters get the level of the preceding character. */
+    for (i = 0, level = paragraphLevel; i < length; i++) {
+        t = types[i];
+        if (t == MINIUCD_BC_BN) {
+            levels[i] = level;
+            continue;
+        }
+        if (!(levels[i] & 1)) {
+            if (t == MINIUCD_BC_R) levels[i] += 1;
+            else if (t == MINIUCD_BC_AN || t == MINIUCD_BC_EN) levels[i] += 2;
+        } else if (t == MINIUCD_BC_L || t == MINIUCD_BC_AN || t == MINIUCD_BC_EN) {
+            levels[i] += 1;
+        }
+        level = levels[i];
+    }
+
+    /* L1: separators, and whitespace before them or at end of paragraph. */
+    for (i = 0, ws = length; i < length; i++) {
+        t = orig[i];
+        if (UCD_BIDI_IS(t, UCD_BIDI_TRAILING_MASK)) {
+            if (ws == length) ws = i;
+        } else if (t == MINIUCD_BC_S || t == MINIUCD_BC_B) {
+            if (ws == length) ws = i;
+            for (; ws <= i; ws++) levels[ws] = paragraphLevel;
+            ws = length;
+        } else {
+            ws = length;
+        }
+    }
+    for (; ws < length; ws++) levels[ws] = paragraphLevel;
+
+    return paragraphLevel;
+}
+
+/**
+ * Reorder a line of resolved text (rules L1 for the end of line, and L2).
+ *
+ * Lines are consecutive parts of a paragraph, along with their resolved
+ * levels.
+ *
+ * @see MiniUCD_BidiResolve
+ */
+void
+MiniUCD_BidiReorder(
+    const MiniUCD_Char *text,    /*!< Line text. */
+    const unsigned char *levels, /*!< Resolved levels of line text. */
+    size_t length,               /*!< Line length. */
+    int paragraphLevel,          /*!< Paragraph embedding level. */
+
+    /*! [out] Logical index of each character in visual order, must have room
+     *        for **length** entries. */
+    size_t *order)
+{
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    size_t end, i, j, k;
+    int maxLevel = 0, minOddLevel = MINIUCD_BIDI_MAX_DEPTH+2, level;
+
+#define LEVEL(i) ((i) < end ? levels[i] : paragraphLevel)
+
+    /* L1: trailing whitespace. */
+    for (end = length; end > 0 && UCD_BIDI_IS(miniucdGetBidiClass(text[end-1], &cursor), UCD_BIDI_TRAILING_MASK); end--);
+
+    for (i = 0; i < length; i++) {
+        order[i] = i;
+        level = LEVEL(i);
+        if (level > maxLevel) maxLevel = level;
+        if ((level & 1) && level < minOddLevel) minOddLevel = level;
+    }
+
+    /* L2 */
+    for (level = maxLevel; level >= minOddLevel; level--) {
+        for (i = 0; i < length; i = j) {
+            if (LEVEL(order[i]) < level) {
+                j = i+1;
+                continue;
+            }
+            for (j = i; j < length && LEVEL(order[j]) >= level; j++);
+            for (k = 0; k < (j-i)/2; k++) {
+                size_t tmp = order[i+k];
+                order[i+k] = order[j-1-k];
+                order[j-1-k] = tmp;
+            }
+        }
+    }
+
+#undef LEVEL
+}
+
+/* End of Bidirectional Algorithm */
+
+
+/*******************************************************************************
+ * Display Width
+ ******************************************************************************/
+
+/**
+ * Get display width of codepoint.
+ *
+ * @return Number of columns taken by the codepoint when displayed alone: 0, 1
+ *         or 2.
+ *
+ * @see MiniUCD_StringWidth
+ */
+int
+MiniUCD_CharWidth(
+    MiniUCD_Char c,     /*!< Codepoint. */
+    int ambiguousWidth) /*!< Width of East Asian Ambiguous characters: 1 in
+                         *   most contexts, 2 in East Asian legacy contexts. */
+{
+    int width;
+    if (c >= 0x20 && c < 0x7F) return 1;
+    if (c > 0x10FFFF) return 1;
+    width = (ucdWidthBlocks[ucdWidthIndex[c >> 8]][(c & 0xFF) >> 2] >> ((c & 3) << 1)) & 3;
+    return (width == UCD_WIDTH_AMBIGUOUS ? ambiguousWidth : width);
+}
+
+/**
+ * Get display width of string.
+ *
+ * Text is split into extended grapheme clusters, each displayed as a single
+ * cell: a cluster takes as many columns as its widest codepoint, or two
+ * columns for emoji presentation sequences (emoji followed by U+FE0F VARIATION
+ * SELECTOR-16) and flags (pairs of regional indicators).
+ *
+ * @return Number of columns taken by the string.
+ *
+ * @see MiniUCD_CharWidth
+ */
+size_t
+MiniUCD_StringWidth(
+    const MiniUCD_Char *text, /*!< Codepoints. */
+    size_t length,            /*!< Number of codepoints. */
+    int ambiguousWidth)       /*!< Width of East Asian Ambiguous characters,
+                               *   see MiniUCD_CharWidth(). */
+{
+    size_t width = 0, i;
+    int state = UCD_GRAPHEMEBREAK_INITIAL, clusterWidth = 0, cls, w;
+    MiniUCD_Char base = 0;
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    for (i = 0; i < length; i++) {
+        MiniUCD_Char c = text[i];
+        unsigned short entry = ucdStates_graphemeBreak[state][cls = miniucdGetGraphemeBreakClass(c, &cursor)];
+        state = entry & UCD_SEGMENT_STATE;
+        if (entry & UCD_SEGMENT_BREAK) {
+            /* New cluster. */
+            width += clusterWidth;
+            clusterWidth = 0;
+            base = c;
+        } else if (cls == UCD_GRAPHEMEBREAK_RI
+                || (c == 0xFE0F && MiniUCD_GetProperty_Emoji(base))) {
+            /* Flag or emoji presentation sequence. */
+            clusterWidth = 2;
+            continue;
+        }
+        w = MiniUCD_CharWidth(c, ambiguousWidth);
+        if (w > clusterWidth) clusterWidth = w;
+    }
+    return width + clusterWidth;
+}
+
+/* End of Display Width */
+
+
+/*******************************************************************************
+ * Identifiers
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Decode UTF-8 sequence.
+ *
+ * Overlong sequences, surrogates and codepoints above U+10FFFF are rejected.
+ *
+ * @return Number of bytes decoded, or 0 if the sequence is invalid or
+ *         truncated.
+ */
+static size_t
+miniucdDecodeUtf8(
+    const unsigned char *utf8, /*!< UTF-8 bytes. */
+    size_t length,             /*!< Number of bytes available. */
+    MiniUCD_Char *c)           /*!< [out] Decoded codepoint. */
+{
+    size_t n, i;
+    MiniUCD_Char min;
+    if (length == 0) return 0;
+    if (utf8[0] < 0x80) {
+        *c = utf8[0];
+        return 1;
+    } else if (utf8[0] < 0xC2) {
+        return 0;
+    } else if (utf8[0] < 0xE0) {
+        n = 2; min = 0x80; *c = utf8[0] & 0x1F;
+    } else if (utf8[0] < 0xF0) {
+        n = 3; min = 0x800; *c = utf8[0] & 0x0F;
+    } else if (utf8[0] < 0xF5) {
+        n = 4; min = 0x10000; *c = utf8[0] & 0x07;
+    } else {
+        return 0;
+    }
+    if (length < n) return 0;
+    for (i = 1; i < n; i++) {
+        if ((utf8[i] & 0xC0) != 0x80) return 0;
+        *c = (*c << 6) | (utf8[i] & 0x3F);
+    }
+    if (*c < min || *c > 0x10FFFF || (*c >= 0xD800 && *c <= 0xDFFF)) return 0;
+    return n;
+}
+
+/**
+ * Tell whether a codepoint of the given identifier class is accepted.
+ *
+ * @return Nonzero if accepted.
+ *
+ * @see ucdValues_identifier
+ */
+static int
+miniucdIsIdentifierClass(
+    int cls,     /*!< Identifier class. */
+    int start,   /*!< Whether this is the first codepoint. */
+    int options) /*!< Identifier scanning options. */
+{
+    switch (cls) {
+    case UCD_IDENTIFIER_START:          return 1;
+    case UCD_IDENTIFIER_CONTINUE:       return !start;
+    case UCD_IDENTIFIER_START_NOTNFKC:  return !(options & MINIUCD_IDENTIFIER_NFKC);
+    case UCD_IDENTIFIER_CONTINUE_NOTNFKC:
+        return !start && !(options & MINIUCD_IDENTIFIER_NFKC);
+    default:                            return 0;
+    }
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Scan identifier at the start of UTF-8 text.
+ *
+ * Identifiers follow the UAX #31 default syntax: a XID_Start character
+ * followed by any number of XID_Continue characters. Scanning stops at the
+ * first character that doesn't match, or at the first invalid UTF-8 sequence.
+ *
+ * @return Length in bytes of the longest identifier prefix, 0 if the text
+ *         doesn't start with an identifier.
+ *
+ * @see MINIUCD_IDENTIFIER_NFKC
+ */
+size_t
+MiniUCD_ScanIdentifier(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    int options)               /*!< Identifier scanning options. */
+{
+    size_t i = 0, n;
+    MiniUCD_Char c;
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    for (;;) {
+        /* ASCII fast path. */
+        while (i < length && utf8[i] < 0x80) {
+            if (i == 0 && utf8[i] == '_' && (options & MINIUCD_IDENTIFIER_UNDERSCORE)) {
+                i++;
+                continue;
+            }
+            if (!miniucdIsIdentifierClass(ucdAscii_identifier[utf8[i]], i == 0, options)) return i;
+            i++;
+        }
+        if (i == length || !(n = miniucdDecodeUtf8(utf8+i, length-i, &c))) return i;
+        if (!miniucdIsIdentifierClass(ucdValues_identifier[miniucdGetRangeCursor(c, ucdRanges_identifier, UCD_NBRANGES_IDENTIFIER, &cursor)], i == 0, options)) return i;
+        i += n;
+    }
+}
+
+/* End of Identifiers */
+
+
+/*******************************************************************************
+ * Script Runs
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/*
+ * Script set operations.
+ */
+#define UCD_SCRIPTSET_HAS(set, sc) \
+    ((set).bits[(sc) >> 5] & (1UL << ((sc) & 31)))
+#define UCD_SCRIPTSET_ADD(set, sc) \
+    ((set).bits[(sc) >> 5] |= (1UL << ((sc) & 31)))
+#define UCD_SCRIPTSET_CLEAR(set) \
+    memset((set).bits, 0, sizeof((set).bits))
+
+/**
+ * Get scripts of codepoint.
+ *
+ * @return Zero-terminated list of scripts (Script_Extensions value).
+ */
+static const unsigned char *
+miniucdGetScripts(
+    MiniUCD_Char c,              /*!< Codepoint to get scripts for. */
+    MiniUCD_RangeCursor *cursor, /*!< [in,out] Lookup cursor. */
+
+    /*! [out] Buffer for single-script lists, must have room for 2 entries. */
+    unsigned char *single)
+{
+    if (c < 0x80) {
+        single[0] = (unsigned char) ucdAscii_sc[c];
+        single[1] = 0;
+        return single;
+    }
+    return ucdAtoms_scx + ucdValues_scx[miniucdGetRangeCursor(c, ucdRanges_scx, UCD_NBRANGES_SCX, cursor)];
+}
+
+/**
+ * Change script of current run, and update brackets opened in the run.
+ */
+static void
+miniucdScriptRunResolve(
+    MiniUCD_ScriptRunIterator *it, /*!< Iterator. */
+    MiniUCD_Sc script)             /*!< New script. */
+{
+    int i;
+    for (i = it->runBrackets; i < it->nbBrackets; i++) {
+        if (it->brackets[i].script == it->script) it->brackets[i].script = script;
+    }
+    it->script = script;
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Initialize script run iterator at the start of text.
+ *
+ * @see MiniUCD_ScriptRunIterator
+ */
+void
+MiniUCD_ScriptRunInit(
+    MiniUCD_ScriptRunIterator *it) /*!< Iterator to initialize. */
+{
+    it->index = 0;
+    it->start = 0;
+    it->script = MINIUCD_SC_ZYYY;
+    UCD_SCRIPTSET_CLEAR(it->scripts);
+    it->nbBrackets = 0;
+    it->runBrackets = 0;
+    it->cursor.first = 1;
+    it->cursor.last = 0;
+    it->cursor.index = 0;
+}
+
+/**
+ * Feed the next codepoint to the script run iterator.
+ *
+ * @return Number of runs found (at most 1): the run ending before this
+ *         codepoint if any.
+ *
+ * @see MiniUCD_ScriptRunIterator
+ */
+int
+MiniUCD_ScriptRunPush(
+    MiniUCD_ScriptRunIterator *it, /*!< Iterator. */
+    MiniUCD_Char c,                /*!< Next codepoint. */
+    MiniUCD_ScriptRun *run)        /*!< [out] Run found. */
+{
+    unsigned char single[2];
+    const unsigned char *scripts = miniucdGetScripts(c, &it->cursor, single), *s;
+    MiniUCD_Bpt bpt = MINIUCD_BPT_N;
+    MiniUCD_ScriptSet common;
+    MiniUCD_Sc first = 0;
+    int nb = 0, i;
+
+    if (scripts[1] != 0 || scripts[0] == MINIUCD_SC_ZYYY) {
+        /* Paired brackets are Common or shared by several scripts. */
+        bpt = MiniUCD_GetProperty_Bpt(c);
+        if (bpt == MINIUCD_BPT_C) {
+            MiniUCD_Char bracket = miniucdBidiBracket(c);
+            for (i = it->nbBrackets-1; i >= 0; i--) {
+                if (it->brackets[i].bracket != bracket) continue;
+
+                /* Closing bracket takes script of opening one. */
+                it->nbBrackets = i;
+                if (it->runBrackets > i) it->runBrackets = i;
+                if (it->brackets[i].script != MINIUCD_SC_ZYYY) {
+                    single[0] = (unsigned char) it->brackets[i].script;
+                    single[1] = 0;
+                    scripts = single;
+                }
+                break;
+            }
+        }
+    }
+
+    if (scripts[1] == 0 && (scripts[0] == MINIUCD_SC_ZYYY || scripts[0] == MINIUCD_SC_ZINH)) {
+        /* Common and Inherited characters continue the current run. */
+    } else if (it->script == MINIUCD_SC_ZYYY) {
+        /* First character with a script resolves the current run. */
+        for (s = scripts; *s; s++) UCD_SCRIPTSET_ADD(it->scripts, *s);
+        miniucdScriptRunResolve(it, (MiniUCD_Sc) scripts[0]);
+    } else {
+        /* Narrow down candidate scripts. */
+        UCD_SCRIPTSET_CLEAR(common);
+        for (s = scripts; *s; s++) {
+            if (!UCD_SCRIPTSET_HAS(it->scripts, *s)) continue;
+            UCD_SCRIPTSET_ADD(common, *s);
+            if (!first) first = (MiniUCD_Sc) *s;
+        }
+        if (first) {
+            it->scripts = common;
+            if (!UCD_SCRIPTSET_HAS(common, it->script)) miniucdScriptRunResolve(it, first);
+        } else {
+            /* No common script, start a new run. */
+            run->start = it->start;
+            run->end = it->index;
+            run->script = it->script;
+            nb = 1;
+            it->start = it->index;
+            it->runBrackets = it->nbBrackets;
+            UCD_SCRIPTSET_CLEAR(it->scripts);
+            for (s = scripts; *s; s++) UCD_SCRIPTSET_ADD(it->scripts, *s);
+            it->script = (MiniUCD_Sc) scripts[0];
+        }
+    }
+
+    if (bpt == MINIUCD_BPT_O) {
+        if (it->nbBrackets == MINIUCD_SCRIPTRUN_MAX_BRACKETS) {
+            /* Forget outermost bracket. */
+            memmove(it->brackets, it->brackets+1, sizeof(it->brackets[0]) * (MINIUCD_SCRIPTRUN_MAX_BRACKETS-1));
+            it->nbBrackets--;
+            if (it->runBrackets > 0) it->runBrackets--;
+        }
+        it->brackets[it->nbBrackets].bracket = miniucdBidiBracket(c);
+        it->brackets[it->nbBrackets].script = it->script;
+        it->nbBrackets++;
+    }
+
+    it->index++;
+    return nb;
+}
+
+/**
+ * Feed a buffer of codepoints to the script run iterator.
+ *
+ * This is equivalent to calling MiniUCD_ScriptRunPush() for each codepoint.
+ *
+ * @return Number of runs found.
+ *
+ * @see MiniUCD_ScriptRunIterator
+ */
+size_t
+MiniUCD_ScriptRunFeed(
+    MiniUCD_ScriptRunIterator *it, /*!< Iterator. */
+    const MiniUCD_Char *text,      /*!< Codepoints to feed. */
+    size_t length,                 /*!< Number of codepoints to feed. */
+
+    /*! [out] Runs, must have room for **length** entries. */
+    MiniUCD_ScriptRun *runs)
+{
+    size_t nb = 0, i;
+    for (i = 0; i < length; i++) {
+        nb += MiniUCD_ScriptRunPush(it, text[i], runs+nb);
+    }
+    return nb;
+}
+
+/**
+ * Signal the end of text to the script run iterator.
+ *
+ * The iterator is reset afterwards and can be reused for a new text.
+ *
+ * @return Number of runs found (at most 1): the last run, unless the text is
+ *         empty.
+ *
+ * @see MiniUCD_ScriptRunIterator
+ */
+int
+MiniUCD_ScriptRunEnd(
+    MiniUCD_ScriptRunIterator *it, /*!< Iterator. */
+    MiniUCD_ScriptRun *run)        /*!< [out] Run found. */
+{
+    int nb = 0;
+    if (it->index > it->start) {
+        run->start = it->start;
+        run->end = it->index;
+        run->script = it->script;
+        nb = 1;
+    }
+    MiniUCD_ScriptRunInit(it);
+    return nb;
+}
+
+/* End of Script Runs */
+
+
+/*******************************************************************************
+ * Mixed-Script Detection
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Get augmented script set of codepoint.
+ *
+ * @return Script set words.
+ *
+ * @see ucdScriptSets
+ */
+static const unsigned long *
+miniucdGetScriptSet(
+    MiniUCD_Char c,              /*!< Codepoint to get script set for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    return ucdScriptSets[ucdScriptSetIndices_scx[miniucdGetRangeCursor(c, ucdRanges_scx, UCD_NBRANGES_SCX, cursor)]];
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Get resolved script set of string (UTS #39 section 5.1).
+ *
+ * The resolved script set is the intersection of the augmented script sets
+ * of all characters; Common and Inherited characters belong to all scripts.
+ *
+ * @return Nonzero if the resolved script set is not empty, i.e. the string
+ *         is single-script.
+ *
+ * @see MiniUCD_ScriptSet
+ */
+int
+MiniUCD_GetResolvedScriptSet(
+    const MiniUCD_Char *text, /*!< Codepoints. */
+    size_t length,            /*!< Number of codepoints. */
+    MiniUCD_ScriptSet *set)   /*!< [out] Resolved script set. */
+{
+    size_t i;
+    int w;
+    unsigned long any = 0;
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    memcpy(set->bits, ucdScriptSet_all, sizeof(set->bits));
+    for (i = 0; i < length; i++) {
+        const unsigned long *scripts = miniucdGetScriptSet(text[i], &cursor);
+        for (w = 0; w < MINIUCD_SCRIPTSET_WORDS; w++) set->bits[w] &= scripts[w];
+    }
+    for (w = 0; w < MINIUCD_SCRIPTSET_WORDS; w++) any |= set->bits[w];
+    return (any != 0);
+}
+
+/**
+ * Get restriction level of string (UTS #39 section 5.2).
+ *
+ * Identifier_Status is not part of the UCD, so characters outside of the
+ * identifier profile are not detected: a string is Unrestricted when it has
+ * characters from scripts that are not Recommended (UAX #31).
+ *
+ * @return Restriction level.
+ *
+ * @see MiniUCD_RestrictionLevel
+ */
+MiniUCD_RestrictionLevel
+MiniUCD_GetRestrictionLevel(
+    const MiniUCD_Char *text, /*!< Codepoints. */
+    size_t length)            /*!< Number of codepoints. */
+{
+    MiniUCD_ScriptSet resolved, moderate;
+    size_t i;
+    int w, ascii = 1, highly = 7, restricted = 0;
+    unsigned long any;
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    memcpy(resolved.bits, ucdScriptSet_all, sizeof(resolved.bits));
+    memcpy(moderate.bits, ucdScriptSet_moderatelyRestrictive, sizeof(moderate.bits));
+    for (i = 0; i < length; i++) {
+        const unsigned long *scripts = miniucdGetScriptSet(text[i], &cursor);
+        unsigned long h1 = 0, h2 = 0, h3 = 0, recommended = 0, latin = 0;
+        if (text[i] >= 0x80) ascii = 0;
+        for (w = 0; w < MINIUCD_SCRIPTSET_WORDS; w++) {
+            resolved.bits[w] &= scripts[w];
+            h1 |= scripts[w] & ucdScriptSet_highlyRestrictive1[w];
+            h2 |= scripts[w] & ucdScriptSet_highlyRestrictive2[w];
+            h3 |= scripts[w] & ucdScriptSet_highlyRestrictive3[w];
+            recommended |= scripts[w] & ucdScriptSet_recommended[w];
+            latin |= scripts[w] & ucdScriptSet_latin[w];
+        }
+        if (!h1) highly &= ~1;
+        if (!h2) highly &= ~2;
+        if (!h3) highly &= ~4;
+        if (!recommended) restricted = 1;
+        if (!latin) {
+            /* Not covered by Latin, must be covered by the other script. */
+            for (w = 0; w < MINIUCD_SCRIPTSET_WORDS; w++) moderate.bits[w] &= scripts[w];
+        }
+    }
+    if (ascii) return MINIUCD_RESTRICTION_ASCII_ONLY;
+    for (any = 0, w = 0; w < MINIUCD_SCRIPTSET_WORDS; w++) any |= resolved.bits[w];
+    if (any) return MINIUCD_RESTRICTION_SINGLE_SCRIPT;
+    if (highly) return MINIUCD_RESTRICTION_HIGHLY_RESTRICTIVE;
+    for (any = 0, w = 0; w < MINIUCD_SCRIPTSET_WORDS; w++) any |= moderate.bits[w];
+    if (any) return MINIUCD_RESTRICTION_MODERATELY_RESTRICTIVE;
+    if (!restricted) return MINIUCD_RESTRICTION_MINIMALLY_RESTRICTIVE;
+    return MINIUCD_RESTRICTION_UNRESTRICTED;
+}
+
+/* End of Mixed-Script Detection */
+
+
+/*******************************************************************************
+ * Numeric Values
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Get decimal digit set of codepoint.
+ *
+ * @return Index of the digit set in #ucdDigitZeros, or -1 if the codepoint is
+ *         not a decimal digit.
+ */
+static int
+miniucdGetDigitZero(
+    MiniUCD_Char c) /*!< Codepoint. */
+{
+    int first = 0, last = UCD_NBDIGITZEROS-1, middle;
+    if (c < ucdDigitZeros[0]) return -1;
+    while (first < last) {
+        middle = (first + last + 1) / 2;
+        if (ucdDigitZeros[middle] <= c) first = middle;
+        else last = middle - 1;
+    }
+    return (c - ucdDigitZeros[first] < 10 ? first : -1);
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Get numeric value of codepoint as a rational.
+ *
+ * @return Nonzero if the codepoint has a numeric value.
+ *
+ * @see MiniUCD_GetProperty_Nv
+ */
+int
+MiniUCD_GetNumericValue(
+    MiniUCD_Char c,       /*!< Codepoint. */
+    int64_t *numerator,   /*!< [out] Numerator. */
+    int64_t *denominator) /*!< [out] Denominator (positive). */
+{
+    const struct ucdRational *rational = ucdRationals_nv + ucdValues_nv[miniucdGetRange(c, ucdRanges_nv, UCD_NBRANGES_NV)];
+    if (!rational->denominator) return 0;
+    *numerator = rational->numerator;
+    *denominator = rational->denominator;
+    return 1;
+}
+
+/**
+ * Get numeric value of codepoint as a floating point number.
+ *
+ * @return Nonzero if the codepoint has a numeric value.
+ *
+ * @see MiniUCD_GetProperty_Nv
+ */
+int
+MiniUCD_GetNumericDouble(
+    MiniUCD_Char c, /*!< Codepoint. */
+    double *value)  /*!< [out] Value. */
+{
+    const struct ucdRational *rational = ucdRationals_nv + ucdValues_nv[miniucdGetRange(c, ucdRanges_nv, UCD_NBRANGES_NV)];
+    if (!rational->denominator) return 0;
+    *value = rational->value;
+    return 1;
+}
+
+/**
+ * Get value of decimal digit (Numeric_Type=Decimal).
+ *
+ * @return Digit value (0-9), or -1 if the codepoint is not a decimal digit.
+ */
+int
+MiniUCD_GetDigitValue(
+    MiniUCD_Char c) /*!< Codepoint. */
+{
+    int index;
+    if (c >= '0' && c <= '9') return (int) (c - '0');
+    if ((index = miniucdGetDigitZero(c)) < 0) return -1;
+    return (int) (c - ucdDigitZeros[index]);
+}
+
+/**
+ * Parse decimal digits at the start of text.
+ *
+ * Digits must all belong to the same decimal digit set (e.g. ASCII,
+ * Arabic-Indic, Devanagari or fullwidth digits), as in UTS #39 section 5.3;
+ * parsing stops at the first codepoint that is not a digit of the same set,
+ * or before the value overflows.
+ *
+ * @return Number of digits parsed.
+ *
+ * @see MiniUCD_GetDigitValue
+ */
+size_t
+MiniUCD_ParseDigits(
+    const MiniUCD_Char *text, /*!< Codepoints. */
+    size_t length,            /*!< Number of codepoints. */
+    uint64_t *value)          /*!< [out] Parsed value, 0 if no digits. */
+{
+    size_t i;
+    int index;
+    MiniUCD_Char zero;
+    uint64_t v = 0, max = (uint64_t) -1;
+    *value = 0;
+    if (length == 0 || (index = miniucdGetDigitZero(text[0])) < 0) return 0;
+    zero = ucdDigitZeros[index];
+    for (i = 0; i < length && text[i] >= zero && text[i] - zero < 10; i++) {
+        unsigned int digit = (unsigned int) (text[i] - zero);
+        if (v > (max - digit) / 10) break;
+        v = v * 10 + digit;
+    }
+    *value = v;
+    return i;
+}
+
+/* End of Numeric Values */
+
+
+/*******************************************************************************
+ * Emoji Sequences
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Get emoji class for given codepoint.
+ *
+ * @return Emoji class.
+ *
+ * @see ucdValues_emojiSequence
+ */
+static int
+miniucdGetEmojiClass(
+    MiniUCD_Char c,              /*!< Codepoint to get class for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdAscii_emojiSequence[c];
+    return ucdValues_emojiSequence[miniucdGetRangeCursor(c, ucdRanges_emojiSequence, UCD_NBRANGES_EMOJISEQUENCE, cursor)];
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Find the next emoji sequence in text.
+ *
+ * The longest sequence is recognized at each position, so that e.g. a ZWJ
+ * sequence is reported as a whole rather than as its individual emoji. To
+ * iterate over all sequences, call again with the end of the previous one:
+ *
+ * @code
+ * MiniUCD_EmojiSequence seq;
+ * size_t i;
+ * for (i = 0; MiniUCD_NextEmojiSequence(text, length, i, &seq); i = seq.end) {
+ *     ...
+ * }
+ * @endcode
+ *
+ * @return Nonzero if a sequence was found.
+ *
+ * @see MiniUCD_EmojiSequence
+ */
+int
+MiniUCD_NextEmojiSequence(
+    const MiniUCD_Char *text,         /*!< Codepoints. */
+    size_t length,                    /*!< Number of codepoints. */
+    size_t index,                     /*!< Index to start searching from. */
+    MiniUCD_EmojiSequence *sequence)  /*!< [out] Sequence found. */
+{
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    size_t start, i, end = 0;
+    int state, type;
+    for (start = index; start < length; start++) {
+        state = UCD_EMOJI_INITIAL;
+        type = 0;
+        for (i = start; i < length && state != UCD_EMOJI_END; i++) {
+            unsigned short entry = ucdStates_emoji[state][miniucdGetEmojiClass(text[i], &cursor)];
+            if (entry & UCD_EMOJI_REJECT) {
+                type = 0;
+            } else if (entry & UCD_EMOJI_TYPE) {
+                type = (entry & UCD_EMOJI_TYPE) >> UCD_EMOJI_TYPE_SHIFT;
+                end = i+1;
+            }
+            state = entry & UCD_EMOJI_STATE;
+        }
+        if (type) {
+            sequence->start = start;
+            sequence->end = end;
+            sequence->type = (MiniUCD_EmojiType) type;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* End of Emoji Sequences */
+
+
+/*******************************************************************************
+ * Vertical Orientation
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Get vertical orientation of codepoint.
+ *
+ * @return Value of UCD property '**vo**'.
+ *
+ * @see MiniUCD_GetProperty_Vo
+ */
+static MiniUCD_Vo
+miniucdGetVerticalOrientation(
+    MiniUCD_Char c,              /*!< Codepoint. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdAscii_vo[c];
+    return ucdValues_vo[miniucdGetRangeCursor(c, ucdRanges_vo, UCD_NBRANGES_VO, cursor)];
+}
+
+/**
+ * Close the current grapheme cluster, and the current run if the cluster
+ * orientation differs.
+ *
+ * @return Number of runs found (at most 1).
+ */
+static int
+miniucdVerticalRunCluster(
+    MiniUCD_VerticalRunIterator *it, /*!< Iterator. */
+    size_t index,                    /*!< Index after the cluster. */
+    MiniUCD_VerticalRun *run)        /*!< [out] Run found. */
+{
+    int nb = 0;
+    if (index == it->cluster) return 0;
+    if (it->cluster == it->start) {
+        /* First cluster of run. */
+        it->orientation = it->clusterOrientation;
+    } else if (it->clusterOrientation != it->orientation) {
+        run->start = it->start;
+        run->end = it->cluster;
+        run->orientation = it->orientation;
+        nb = 1;
+        it->start = it->cluster;
+        it->orientation = it->clusterOrientation;
+    }
+    it->cluster = index;
+    return nb;
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Initialize vertical orientation run iterator at the start of text.
+ *
+ * @see MiniUCD_VerticalRunIterator
+ */
+void
+MiniUCD_VerticalRunInit(
+    MiniUCD_VerticalRunIterator *it) /*!< Iterator to initialize. */
+{
+    it->start = 0;
+    it->orientation = MINIUCD_VO_R;
+    it->cluster = 0;
+    it->clusterOrientation = MINIUCD_VO_R;
+    MiniUCD_GraphemeBreakInit(&it->grapheme);
+    it->cursor.first = 1;
+    it->cursor.last = 0;
+    it->cursor.index = 0;
+}
+
+/**
+ * Feed the next codepoint to the vertical orientation run iterator.
+ *
+ * @return Number of runs found (at most 1): the run ending before the
+ *         grapheme cluster preceding this codepoint, if any.
+ *
+ * @see MiniUCD_VerticalRunIterator
+ */
+int
+MiniUCD_VerticalRunPush(
+    MiniUCD_VerticalRunIterator *it, /*!< Iterator. */
+    MiniUCD_Char c,                  /*!< Next codepoint. */
+    MiniUCD_VerticalRun *run)        /*!< [out] Run found. */
+{
+    size_t index = it->grapheme.index;
+    MiniUCD_Vo vo = miniucdGetVerticalOrientation(c, &it->cursor);
+    int nb = 0;
+    size_t boundary;
+
+    if (MiniUCD_GraphemeBreakPush(&it->grapheme, c, &boundary)) {
+        /* New cluster. */
+        nb = miniucdVerticalRunCluster(it, index, run);
+        it->clusterOrientation = vo;
+    } else if (vo == MINIUCD_VO_U && it->clusterOrientation != MINIUCD_VO_U
+            && MiniUCD_GetProperty_Gc(c) == MINIUCD_GC_ME) {
+        /* Upright enclosing mark. */
+        it->clusterOrientation = MINIUCD_VO_U;
+    }
+    return nb;
+}
+
+/**
+ * Feed a buffer of codepoints to the vertical orientation run iterator.
+ *
+ * This is equivalent to calling MiniUCD_VerticalRunPush() for each
+ * codepoint.
+ *
+ * @return Number of runs found.
+ *
+ * @see MiniUCD_VerticalRunIterator
+ */
+size_t
+MiniUCD_VerticalRunFeed(
+    MiniUCD_VerticalRunIterator *it, /*!< Iterator. */
+    const MiniUCD_Char *text,        /*!< Codepoints to feed. */
+    size_t length,                   /*!< Number of codepoints to feed. */
+
+    /*! [out] Runs, must have room for **length** entries. */
+    MiniUCD_VerticalRun *runs)
+{
+    size_t nb = 0, i;
+    for (i = 0; i < length; i++) {
+        nb += MiniUCD_VerticalRunPush(it, text[i], runs+nb);
+    }
+    return nb;
+}
+
+/**
+ * Signal the end of text to the vertical orientation run iterator.
+ *
+ * The iterator is reset afterwards and can be reused for a new text.
+ *
+ * @return Number of runs found (at most 2): the runs ending with the last
+ *         grapheme cluster, unless the text is empty.
+ *
+ * @see MiniUCD_VerticalRunIterator
+ */
+int
+MiniUCD_VerticalRunEnd(
+    MiniUCD_VerticalRunIterator *it, /*!< Iterator. */
+
+    /*! [out] Runs, must have room for 2 entries. */
+    MiniUCD_VerticalRun *runs)
+{
+    size_t index = it->grapheme.index;
+    int nb = miniucdVerticalRunCluster(it, index, runs);
+    if (index > it->start) {
+        runs[nb].start = it->start;
+        runs[nb].end = index;
+        runs[nb].orientation = it->orientation;
+        nb++;
+    }
+    MiniUCD_VerticalRunInit(it);
+    return nb;
+}
+
+/* End of Vertical Orientation */
+
+
+/*******************************************************************************
+ * Cursive Joining
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Get joining class for given codepoint.
+ *
+ * @return Joining class.
+ *
+ * @see ucdValues_joining
+ */
+static int
+miniucdGetJoiningClass(
+    MiniUCD_Char c,              /*!< Codepoint to get class for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdAscii_joining[c];
+    return ucdValues_joining[miniucdGetRangeCursor(c, ucdRanges_joining, UCD_NBRANGES_JOINING, cursor)];
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Resolve the joining forms of a run of text.
+ *
+ * The text is considered in logical order, and its ends don't join. Each
+ * character gets its form from its own joining class and that of its joining
+ * neighbours, ignoring transparent characters in between.
+ *
+ * @see MiniUCD_JoiningForm
+ */
+void
+MiniUCD_ResolveJoiningForms(
+    const MiniUCD_Char *text, /*!< Codepoints. */
+    size_t length,            /*!< Number of codepoints. */
+
+    /*! [out] #MiniUCD_JoiningForm values, must have room for **length**
+     *        entries. */
+    unsigned char *forms)
+{
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    size_t i, previous = 0;
+    int state = UCD_JOINING_INITIAL, cls;
+    unsigned short entry;
+    for (i = 0; i < length; i++) {
+        cls = miniucdGetJoiningClass(text[i], &cursor);
+        if (cls == UCD_JOINING_T) {
+            forms[i] = MINIUCD_FORM_NONE;
+            continue;
+        }
+        entry = ucdStates_joining[state][cls];
+        if (entry & UCD_JOINING_PREVIOUS) {
+            forms[previous] = (unsigned char) ((entry & UCD_JOINING_PREVIOUS) >> UCD_JOINING_PREVIOUS_SHIFT);
+        }
+        forms[i] = (unsigned char) ((entry & UCD_JOINING_CURRENT) >> UCD_JOINING_CURRENT_SHIFT);
+        previous = i;
+        state = entry & UCD_JOINING_STATE;
+    }
+}
+
+/* End of Cursive Joining */
+
+
+/*******************************************************************************
+ * Canonical Ordering
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/** Size of runs sorted by insertion; longer runs are merged from these. */
+#define UCD_CANONICAL_CHUNK     32
+
+/**
+ * Get canonical combining class of codepoint.
+ *
+ * Constants are numbered in the same order as combining classes, so they can
+ * be compared directly.
+ *
+ * @return Value of UCD property '**ccc**'.
+ *
+ * @see MiniUCD_GetProperty_Ccc
+ */
+static MiniUCD_Ccc
+miniucdGetCanonicalClass(
+    MiniUCD_Char c,              /*!< Codepoint. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    /* First non-starter is U+0300. */
+    if (c < 0x300) return MINIUCD_CCC_0;
+    return ucdValues_ccc[miniucdGetRangeCursor(c, ucdRanges_ccc, UCD_NBRANGES_CCC, cursor)];
+}
+
+/**
+ * Stable sort of a run of non-starters by combining class.
+ *
+ * Chunks of #UCD_CANONICAL_CHUNK codepoints are sorted by insertion, with
+ * their classes cached locally. Longer runs, which only occur in contrived
+ * text, are then merged in place, so that the cost stays in O(n log^2 n).
+ */
+static void
+miniucdCanonicalSort(
+    MiniUCD_Char *text,          /*!< [in,out] Run to sort. */
+    size_t length,               /*!< Length of run. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    unsigned char classes[UCD_CANONICAL_CHUNK], cls;
+    MiniUCD_Char c;
+    size_t chunk, size, i, j, width;
+
+    for (chunk = 0; chunk < length; chunk += UCD_CANONICAL_CHUNK) {
+        size = length - chunk < UCD_CANONICAL_CHUNK ? length - chunk : UCD_CANONICAL_CHUNK;
+        for (i = 0; i < size; i++) {
+            c = text[chunk+i];
+            cls = (unsigned char) miniucdGetCanonicalClass(c, cursor);
+            for (j = i; j > 0 && classes[j-1] > cls; j--) {
+                classes[j] = classes[j-1];
+                text[chunk+j] = text[chunk+j-1];
+            }
+            classes[j] = cls;
+            text[chunk+j] = c;
+        }
+    }
+
+    for (width = UCD_CANONICAL_CHUNK; width < length; width *= 2) {
+        for (i = 0; i + width < length; i += 2*width) {
+            size = length - i - width < width ? length - i - width : width;
+            miniucdCanonicalMerge(text + i, width, size, cursor);
+        }
+    }
+}
+
+/**
+ * Merge two consecutive sorted sequences of non-starters in place.
+ *
+ * The longest sequence is split in half, the other one at the matching
+ * position, and the inner parts are swapped by rotation before merging both
+ * halves recursively.
+ */
+static void
+miniucdCanonicalMerge(
+    MiniUCD_Char *text,          /*!< [in,out] Sequences to merge. */
+    size_t length1,              /*!< Length of first sequence. */
+    size_t length2,              /*!< Length of second sequence. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    size_t cut1, cut2, first, last, middle;
+    MiniUCD_Ccc cls;
+    MiniUCD_Char c;
+
+    if (length1 == 0 || length2 == 0) return;
+    if (length1 + length2 == 2) {
+        if (miniucdGetCanonicalClass(text[1], cursor) < miniucdGetCanonicalClass(text[0], cursor)) {
+            c = text[0]; text[0] = text[1]; text[1] = c;
+        }
+        return;
+    }
+
+    if (length1 > length2) {
+        /* Lower bound of the middle of the first sequence in the second. */
+        cut1 = length1 / 2;
+        cls = miniucdGetCanonicalClass(text[cut1], cursor);
+        first = length1;
+        last = length1 + length2;
+        while (first < last) {
+            middle = first + (last - first) / 2;
+            if (miniucdGetCanonicalClass(text[middle], cursor) < cls) first = middle + 1;
+            else last = middle;
+        }
+        cut2 = first;
+    } else {
+        /* Upper bound of the middle of the second sequence in the first. */
+        cut2 = length1 + length2 / 2;
+        cls = miniucdGetCanonicalClass(text[cut2], cursor);
+        first = 0;
+        last = length1;
+        while (first < last) {
+            middle = first + (last - first) / 2;
+            if (miniucdGetCanonicalClass(text[middle], cursor) <= cls) first = middle + 1;
+            else last = middle;
+        }
+        cut1 = first;
+    }
+
+    /* Rotate [cut1, length1) and [length1, cut2). */
+    miniucdReverse(text + cut1, length1 - cut1);
+    miniucdReverse(text + length1, cut2 - length1);
+    miniucdReverse(text + cut1, cut2 - cut1);
+
+    middle = cut1 + (cut2 - length1);
+    miniucdCanonicalMerge(text, cut1, middle - cut1, cursor);
+    miniucdCanonicalMerge(text + middle, length1 - cut1, length1 + length2 - cut2, cursor);
+}
+
+/**
+ * Reverse codepoints in place.
+ */
+static void
+miniucdReverse(
+    MiniUCD_Char *text, /*!< [in,out] Codepoints. */
+    size_t length)      /*!< Number of codepoints. */
+{
+    size_t i, j;
+    MiniUCD_Char c;
+    if (length < 2) return;
+    for (i = 0, j = length-1; i < j; i++, j--) {
+        c = text[i]; text[i] = text[j]; text[j] = c;
+    }
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Put text in canonical order.
+ *
+ * Each run of non-starters is sorted by Canonical_Combining_Class, keeping
+ * characters of the same class in their original order. Runs already in
+ * order, as in most text, are left untouched after a single scan.
+ *
+ * @return Nonzero if the text was reordered.
+ */
+int
+MiniUCD_CanonicalOrder(
+    MiniUCD_Char *text, /*!< [in,out] Codepoints. */
+    size_t length)      /*!< Number of codepoints. */
+{
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    MiniUCD_Ccc cls, last;
+    size_t i = 0, start;
+    int ordered, reordered = 0;
+
+    while (i < length) {
+        last = miniucdGetCanonicalClass(text[i++], &cursor);
+        if (last == MINIUCD_CCC_0) continue;
+
+        /* Run of non-starters. */
+        start = i-1;
+        ordered = 1;
+        for (; i < length; i++) {
+            cls = miniucdGetCanonicalClass(text[i], &cursor);
+            if (cls == MINIUCD_CCC_0) break;
+            if (cls < last) ordered = 0;
+            last = cls;
+        }
+        if (!ordered) {
+            miniucdCanonicalSort(text + start, i - start, &cursor);
+            reordered = 1;
+        }
+    }
+    return reordered;
+}
+
+/* End of Canonical Ordering */
+
+
+/*******************************************************************************
+ * Text Filtering
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/*
+ * Word-at-a-time byte tests.
+ */
+#define UCD_WORD_ONES           (~(size_t)0 / 0xFF)
+#define UCD_WORD_HIGHS          (UCD_WORD_ONES * 0x80)
+#define UCD_WORD_HAS_LESS(x, n) (((x) - UCD_WORD_ONES*(n)) & ~(x) & UCD_WORD_HIGHS)
+#define UCD_WORD_HAS_MORE(x, n) ((((x) + UCD_WORD_ONES*(0x7F-(n))) | (x)) & UCD_WORD_HIGHS)
+#define UCD_WORD_HAS_BETWEEN(x, m, n) \
+    ((UCD_WORD_ONES*(0x7F+(n)) - ((x) & UCD_WORD_ONES*0x7F)) & ~(x) \
+        & (((x) & UCD_WORD_ONES*0x7F) + UCD_WORD_ONES*(0x7F-(m))) & UCD_WORD_HIGHS)
+
+/**
+ * Scan printable ASCII characters (U+0021 to U+007E), which are neither white
+ * space, nor default ignorable, nor control characters.
+ *
+ * Bytes are tested a machine word at a time.
+ *
+ * @return Number of leading printable ASCII bytes.
+ */
+static size_t
+miniucdScanPrintableAscii(
+    const unsigned char *utf8, /*!< UTF-8 bytes. */
+    size_t length)             /*!< Number of bytes. */
+{
+    size_t i = 0, word;
+    for (; i + sizeof(word) <= length; i += sizeof(word)) {
+        memcpy(&word, utf8+i, sizeof(word));
+        if (UCD_WORD_HAS_LESS(word, 0x21) | UCD_WORD_HAS_MORE(word, 0x7E)) break;
+    }
+    while (i < length && utf8[i] >= 0x21 && utf8[i] <= 0x7E) i++;
+    return i;
+}
+
+/**
+ * Get text filtering class for given codepoint.
+ *
+ * @return Text filtering class.
+ *
+ * @see ucdValues_textFilter
+ */
+static int
+miniucdGetTextFilterClass(
+    MiniUCD_Char c,              /*!< Codepoint to get class for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdAscii_textFilter[c];
+    return ucdValues_textFilter[miniucdGetRangeCursor(c, ucdRanges_textFilter, UCD_NBRANGES_TEXTFILTER, cursor)];
+}
+
+/**
+ * Tell whether a text filtering class is white space.
+ *
+ * @return Nonzero if white space.
+ *
+ * @see MINIUCD_FILTER_PATTERN_SPACE
+ */
+static int
+miniucdIsSpaceClass(
+    int cls,     /*!< Text filtering class. */
+    int options) /*!< Text filtering options. */
+{
+    switch (cls) {
+    case UCD_TEXTFILTER_WSPACE_PATWS: return 1;
+    case UCD_TEXTFILTER_WSPACE: return !(options & MINIUCD_FILTER_PATTERN_SPACE);
+    case UCD_TEXTFILTER_PATWS_DI: return (options & MINIUCD_FILTER_PATTERN_SPACE);
+    default: return 0;
+    }
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Trim leading and trailing white space.
+ *
+ * @return Length of trimmed text in bytes.
+ *
+ * @see MINIUCD_FILTER_PATTERN_SPACE
+ */
+size_t
+MiniUCD_Trim(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    int options,               /*!< Text filtering options. */
+    size_t *start)             /*!< [out] Offset of trimmed text. */
+{
+    size_t i = 0, j, end = length, n;
+    MiniUCD_Char c;
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+
+    while (i < end) {
+        n = miniucdDecodeUtf8(utf8+i, end-i, &c);
+        if (!n || !miniucdIsSpaceClass(miniucdGetTextFilterClass(c, &cursor), options)) break;
+        i += n;
+    }
+    while (end > i) {
+        /* Find start of last character. */
+        j = end-1;
+        while (j > i && end-j < 4 && (utf8[j] & 0xC0) == 0x80) j--;
+        n = miniucdDecodeUtf8(utf8+j, end-j, &c);
+        if (n != end-j || !miniucdIsSpaceClass(miniucdGetTextFilterClass(c, &cursor), options)) break;
+        end = j;
+    }
+    *start = i;
+    return end-i;
+}
+
+/**
+ * Remove default ignorable characters.
+ *
+ * The output is never longer than the input, so it can be written in place.
+ *
+ * @return Length of output in bytes.
+ *
+ * @see MINIUCD_FILTER_CONTROLS
+ * @see MINIUCD_FILTER_KEEP_JOINERS
+ */
+size_t
+MiniUCD_StripDefaultIgnorables(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    int options,               /*!< Text filtering options. */
+
+    /*! [out] Filtered text, must have room for **length** bytes; may be the
+     *        same as **utf8**. */
+    unsigned char *out)
+{
+    size_t i = 0, o = 0, n;
+    int strip;
+    MiniUCD_Char c;
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+
+    while (i < length) {
+        n = miniucdScanPrintableAscii(utf8+i, length-i);
+        if (!n) {
+            n = miniucdDecodeUtf8(utf8+i, length-i, &c);
+            if (!n) {
+                /* Keep invalid byte. */
+                n = 1;
+            } else {
+                switch (miniucdGetTextFilterClass(c, &cursor)) {
+                case UCD_TEXTFILTER_DI:
+                case UCD_TEXTFILTER_PATWS_DI: strip = 1; break;
+                case UCD_TEXTFILTER_JOINER: strip = !(options & MINIUCD_FILTER_KEEP_JOINERS); break;
+                case UCD_TEXTFILTER_CONTROL: strip = (options & MINIUCD_FILTER_CONTROLS); break;
+                default: strip = 0;
+                }
+                if (strip) {
+                    i += n;
+                    continue;
+                }
+            }
+        }
+        memmove(out+o, utf8+i, n);
+        i += n;
+        o += n;
+    }
+    return o;
+}
+
+/**
+ * Replace each run of white space with a single U+0020 SPACE.
+ *
+ * The output is never longer than the input, so it can be written in place.
+ * Leading and trailing white space is collapsed but not removed, see
+ * MiniUCD_Trim().
+ *
+ * @return Length of output in bytes.
+ *
+ * @see MINIUCD_FILTER_PATTERN_SPACE
+ */
+size_t
+MiniUCD_CollapseWhitespace(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    int options,               /*!< Text filtering options. */
+
+    /*! [out] Filtered text, must have room for **length** bytes; may be the
+     *        same as **utf8**. */
+    unsigned char *out)
+{
+    size_t i = 0, o = 0, n;
+    int space = 0;
+    MiniUCD_Char c;
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+
+    while (i < length) {
+        n = miniucdScanPrintableAscii(utf8+i, length-i);
+        if (!n) {
+            n = miniucdDecodeUtf8(utf8+i, length-i, &c);
+            if (!n) {
+                /* Keep invalid byte. */
+                n = 1;
+            } else if (miniucdIsSpaceClass(miniucdGetTextFilterClass(c, &cursor), options)) {
+                if (!space) out[o++] = ' ';
+                space = 1;
+                i += n;
+                continue;
+            }
+        }
+        memmove(out+o, utf8+i, n);
+        i += n;
+        o += n;
+        space = 0;
+    }
+    return o;
+}
+
+/* End of Text Filtering */
+
+
+/*******************************************************************************
+ * Property Lookup
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/** Whether character is ignored by loose matching. */
+#define UCD_LOOSE_IGNORED(c)    ((c) == ' ' || (c) == '_' || (c) == '-')
+
+/** ASCII lowercase of character. */
+#define UCD_LOWER(c)            ((c) >= 'A' && (c) <= 'Z' ? (c)-'A'+'a' : (c))
+
+/**
+ * Hash name for loose matching with FNV-1a, ignoring case, spaces, underscores
+ * and hyphens.
+ *
+ * @return Hash value.
+ *
+ * @see ucdAliases
+ */
+static unsigned long
+miniucdHashAlias(
+    int property,     /*!< Property of value names, zero for property names. */
+    const char *name, /*!< Name to hash. */
+    size_t length)    /*!< Name length. */
+{
+    unsigned long hash = ((0x811C9DC5UL ^ property) * 0x01000193UL) & 0xFFFFFFFFUL;
+    size_t i;
+    for (i = 0; i < length; i++) {
+        if (UCD_LOOSE_IGNORED(name[i])) continue;
+        hash = ((hash ^ (unsigned char) UCD_LOWER(name[i])) * 0x01000193UL)
+            & 0xFFFFFFFFUL;
+    }
+    return hash;
+}
+
+/**
+ * Match name loosely against alias.
+ *
+ * @return Nonzero if name matches.
+ */
+static int
+miniucdMatchAlias(
+    const char *alias, /*!< Loosely matched alias. */
+    const char *name,  /*!< Name to match. */
+    size_t length)     /*!< Name length. */
+{
+    size_t i;
+    for (i = 0; i < length; i++) {
+        if (UCD_LOOSE_IGNORED(name[i])) continue;
+        if (!*alias || *alias != UCD_LOWER(name[i])) return 0;
+        alias++;
+    }
+    return !*alias;
+}
+
+/**
+ * Look up property or value alias in hash table. Names that are not found are
+ * looked up again without their "is" prefix, if any.
+ *
+ * @return Property or value, or -1 if not found.
+ *
+ * @see ucdAliases
+ */
+static int
+miniucdLookupAlias(
+    int property,     /*!< Property of value names, zero for property names. */
+    const char *name, /*!< Name to look up. */
+    size_t length)    /*!< Name length. */
+{
+    unsigned long bucket;
+    int i;
+    size_t prefix;
+    const char *is;
+
+    bucket = miniucdHashAlias(property, name, length) & (UCD_NBALIASBUCKETS-1);
+    for (i = ucdAliasBuckets[bucket]; i < ucdAliasBuckets[bucket+1]; i++) {
+        if (ucdAliases[i].property == property
+                && miniucdMatchAlias(ucdAliases[i].name, name, length)) {
+            return ucdAliases[i].value;
+        }
+    }
+
+    /* Skip loosely matched "is" prefix. */
+    for (prefix = 0, is = "is"; *is; is++, prefix++) {
+        while (prefix < length && UCD_LOOSE_IGNORED(name[prefix])) prefix++;
+        if (prefix == length || UCD_LOWER(name[prefix]) != *is) return -1;
+    }
+    return miniucdLookupAlias(property, name+prefix, length-prefix);
+}
+
+/**
+ * Accumulator of merged codepoint ranges.
+ *
+ * @see MiniUCD_GetPropertyRanges
+ */
+struct ucdRangeSink {
+    MiniUCD_Char *ranges; /*!< Range bounds. */
+    size_t size;          /*!< Maximum number of ranges to store. */
+    size_t nb;            /*!< Number of ranges. */
+    MiniUCD_Char last;    /*!< Last codepoint of last range. */
+};
+
+/**
+ * Add codepoint range to accumulator, merging it with the previous one when
+ * adjacent.
+ */
+static void
+miniucdAddRangeBounds(
+    struct ucdRangeSink *sink, /*!< [in,out] Range accumulator. */
+    MiniUCD_Char first,        /*!< First codepoint of range. */
+    MiniUCD_Char last)         /*!< Last codepoint of range. */
+{
+    if (sink->nb > 0 && first == sink->last+1) {
+        if (sink->nb <= sink->size) sink->ranges[sink->nb*2-1] = last;
+    } else {
+        if (sink->nb < sink->size) {
+            sink->ranges[sink->nb*2] = first;
+            sink->ranges[sink->nb*2+1] = last;
+        }
+        sink->nb++;
+    }
+    sink->last = last;
+}
+
+/**
+ * Add range of values to accumulator.
+ */
+static void
+miniucdAddRange(
+    struct ucdRangeSink *sink,  /*!< [in,out] Range accumulator. */
+    const MiniUCD_Char *ranges, /*!< Array of ranges boundaries. First one is
+                                     omitted (first codepoint is always zero).*/
+    int nbRanges,               /*!< Number of ranges. */
+    int index)                  /*!< Index of range to add. */
+{
+    miniucdAddRangeBounds(sink, (index > 0 ? ranges[index-1] : 0),
+        (index < nbRanges-1 ? ranges[index]-1 : 0x10FFFF));
+}
+
+/**
+ * Add ranges of a boolean property value to accumulator.
+ */
+static void
+miniucdAddBooleanRanges(
+    struct ucdRangeSink *sink,  /*!< [in,out] Range accumulator. */
+    const MiniUCD_Char *ranges, /*!< Array of ranges boundaries. First one is
+                                     omitted (first codepoint is always zero).*/
+    int nbRanges,               /*!< Number of ranges. */
+    int odd)                    /*!< Whether to add odd ranges rather than even
+                                     ones. */
+{
+    int i;
+    for (i = odd; i < nbRanges; i += 2) {
+        miniucdAddRange(sink, ranges, nbRanges, i);
+    }
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Look up property by name or alias, e.g. "Script" or "sc".
+ *
+ * @return Property, or zero if unknown.
+ *
+ * @see MiniUCD_Property
+ */
+MiniUCD_Property
+MiniUCD_LookupProperty(
+    const char *name, /*!< Property name. */
+    size_t length)    /*!< Name length. */
+{
+    int property = miniucdLookupAlias(0, name, length);
+    return (MiniUCD_Property) (property < 0 ? 0 : property);
+}
+
+/**
+ * Look up property value by name or alias, e.g. "Greek" or "Grek" for
+ * #MINIUCD_SC.
+ *
+ * Boolean properties take values such as "Yes", "N" or "True", and
+ * #MINIUCD_SCX takes the values of #MINIUCD_SC.
+ *
+ * @return Value, or -1 if unknown.
+ *
+ * @see MiniUCD_GetPropertyRanges
+ */
+int
+MiniUCD_LookupPropertyValue(
+    MiniUCD_Property property, /*!< Property. */
+    const char *name,          /*!< Value name. */
+    size_t length)             /*!< Name length. */
+{
+    int i;
+    if (property < 1 || property > MINIUCD_NBPROPERTIES) return -1;
+    switch (ucdValueProperties[property]) {
+        case 0:
+            return -1;
+
+        case UCD_VALUES_BOOLEAN:
+            for (i = 0; i < 8; i++) {
+                if (miniucdMatchAlias(ucdBooleanAliases[i], name, length)) {
+                    return i >= 4;
+                }
+            }
+            return -1;
+
+        default:
+            return miniucdLookupAlias(ucdValueProperties[property], name,
+                length);
+    }
+}
+
+/**
+ * Get ranges of codepoints having the given property value.
+ *
+ * Ranges are sorted and disjoint, and are stored as pairs of first and last
+ * codepoints. The total number of ranges is returned even when it exceeds
+ * the given size, so that a first call with a zero size can be used to
+ * allocate the result.
+ *
+ * @return Number of ranges, zero for unsupported properties.
+ *
+ * @see MiniUCD_LookupPropertyValue
+ */
+size_t
+MiniUCD_GetPropertyRanges(
+    MiniUCD_Property property, /*!< Property. */
+    int value,                 /*!< Property value. */
+
+    /*! [out] Range bounds, room for 2*size codepoints. */
+    MiniUCD_Char *ranges,
+
+    /*! Maximum number of ranges to store. */
+    size_t size)
+{
+    struct ucdRangeSink sink;
+    int i;
+
+    sink.ranges = ranges;
+    sink.size = size;
+    sink.nb = 0;
+    sink.last = 0;
+
+    switch (property) {<%
+  for (const [property, info] of Object.entries(properties)) {
+    if (info.type === "deprecated") continue;
+
+    const PROPERTY = property.toUpperCase();
+    switch (info.type) {
+      case "boolean":
+%>
+        case MINIUCD_<%- PROPERTY %>:
+            miniucdAddBooleanRanges(&sink, ucdRanges_<%- property %>,
+                UCD_NBRANGES_<%- PROPERTY %>, (value != 0) != UCD_VALUE_0_<%- PROPERTY %>);
+            break;
+<%
+        break;
+
+      case "enum":
+        if (!info.values) break;
+        if (info.groups) {
+%>
+        case MINIUCD_<%- PROPERTY %>: {
+            unsigned long mask;
+            if (value < 1
+                    || value > MINIUCD_<%- PROPERTY %>_NBVALUES+UCD_<%- PROPERTY %>_NBGROUPS) {
+                break;
+            }
+            mask = (value > MINIUCD_<%- PROPERTY %>_NBVALUES
+                ? ucdGroups_<%- property %>[value-MINIUCD_<%- PROPERTY %>_NBVALUES-1]
+                : 1UL << value);
+            for (i = 0; i < UCD_NBRANGES_<%- PROPERTY %>; i++) {
+                if ((mask >> ucdValues_<%- property %>[i]) & 1) {
+                    miniucdAddRange(&sink, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>, i);
+                }
+            }
+            break;
+        }
+<%
+        } else {
+%>
+        case MINIUCD_<%- PROPERTY %>:
+            for (i = 0; i < UCD_NBRANGES_<%- PROPERTY %>; i++) {
+                if ((int) ucdValues_<%- property %>[i] == value) {
+                    miniucdAddRange(&sink, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>, i);
+                }
+            }
+            break;
+<%
+        }
+        break;
+
+      case "enumList": {
+        const nbValues = properties[info.enumType]?.values?.length || 0;
+        const valueType = nbValues < 256 ? "char" : nbValues < 65536 ? "short" : "int";
+%>
+        case MINIUCD_<%- PROPERTY %>: {
+            const unsigned <%- valueType %> *atom;
+            for (i = 0; i < UCD_NBRANGES_<%- PROPERTY %>; i++) {
+                for (atom = ucdAtoms_<%- property %> + ucdValues_<%- property %>[i]; *atom; atom++) {
+                    if (*atom != value) continue;
+                    miniucdAddRange(&sink, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>, i);
+                    break;
+                }
+            }
+            break;
+        }
+<%
+        break;
+      }
+    }
+  }
+%>
+        default:
             break;
+    }
+    return sink.nb;
+}
+
+/* End of Property Lookup */
+
+
+/*******************************************************************************
+ * Case Closure
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Test whether codepoint belongs to a set of ranges.
+ *
+ * @return Nonzero if member.
+ */
+static int
+miniucdInRanges(
+    MiniUCD_Char c,             /*!< Codepoint to test. */
+    const MiniUCD_Char *ranges, /*!< Sorted pairs of first and last
+                                     codepoints. */
+    size_t nbRanges)            /*!< Number of ranges. */
+{
+    size_t min = 0, max = nbRanges, mid;
+    while (min < max) {
+        mid = min+((max-min)>>1);
+        if (c > ranges[mid*2+1]) min = mid+1;
+        else max = mid;
+    }
+    return (min < nbRanges && c >= ranges[min*2]);
+}
+
+/** @endcond @endprivate */
 
-          case "mcp": {
-            // NUL-terminated codepoint lists.
-            // - For length=0, zero.
-            // - For length=1, offset then zero.
-            // - For length>1, zero-terminated list of codepoint.
-            const atoms = [];
-            for (const value of uniqueValues) {
-              if (value !== 0 && value !== "0") {
-                // Values.
-                if (Array.isArray(value)) {
-                  atoms.push(...value.map(toHex));
-                } else {
-                  atoms.push(value);
+/**
+ * Get the next case variant of a codepoint. Case variants are returned in
+ * ascending order and wrap around, so that iterating until the initial
+ * codepoint enumerates its whole case orbit.
+ *
+ * @return Next case variant, or the codepoint itself if it has none.
+ */
+MiniUCD_Char
+MiniUCD_NextCaseVariant(
+    MiniUCD_Char c) /*!< Codepoint to get case variant for. */
+{
+    MiniUCD_Char offset = ucdValues_caseOrbit[miniucdGetRange(c,
+        ucdRanges_caseOrbit, UCD_NBRANGES_CASEORBIT)];
+    if (offset == UCD_CASEORBIT_EVENODD) return c ^ 1;
+    if (offset == UCD_CASEORBIT_ODDEVEN) return ((c-1) ^ 1) + 1;
+    return c + offset;
+}
+
+/**
+ * Compute the case closure of a set of codepoint ranges, i.e. add all case
+ * variants of its codepoints.
+ *
+ * Ranges are sorted and disjoint pairs of first and last codepoints, both on
+ * input and output. The closure is computed in one pass over the input and
+ * the case orbit table: only codepoints having case variants are tested
+ * individually. The total number of ranges is returned even when it exceeds
+ * the given size, and never exceeds @p nbRanges + #MINIUCD_CASE_NBVARIANTS.
+ *
+ * @return Number of ranges in closure.
+ */
+size_t
+MiniUCD_CaseCloseRanges(
+    /*! Sorted pairs of first and last codepoints. */
+    const MiniUCD_Char *ranges,
+
+    /*! Number of ranges. */
+    size_t nbRanges,
+
+    /*! [out] Range bounds of closure, room for 2*size codepoints. Must not
+     *  overlap the input. */
+    MiniUCD_Char *closure,
+
+    /*! Maximum number of ranges to store. */
+    size_t size)
+{
+    struct ucdRangeSink sink;
+    size_t i = 0, j;
+    int index;
+    MiniUCD_Char first, last, c, variant;
+
+    sink.ranges = closure;
+    sink.size = size;
+    sink.nb = 0;
+    sink.last = 0;
+
+    for (index = 0; index < UCD_NBRANGES_CASEORBIT; index++) {
+        first = (index > 0 ? ucdRanges_caseOrbit[index-1] : 0);
+        last = (index < UCD_NBRANGES_CASEORBIT-1
+            ? ucdRanges_caseOrbit[index]-1 : 0x10FFFF);
+        if (ucdValues_caseOrbit[index] == 0) {
+            /* No case variants, copy intersecting input ranges. */
+            while (i < nbRanges && ranges[i*2+1] < first) i++;
+            for (j = i; j < nbRanges && ranges[j*2] <= last; j++) {
+                miniucdAddRangeBounds(&sink,
+                    (ranges[j*2] > first ? ranges[j*2] : first),
+                    (ranges[j*2+1] < last ? ranges[j*2+1] : last));
+            }
+            continue;
+        }
+
+        /* Codepoints belong to closure if any of their variants is in input. */
+        for (c = first; c <= last; c++) {
+            variant = c;
+            do {
+                if (miniucdInRanges(variant, ranges, nbRanges)) {
+                    miniucdAddRangeBounds(&sink, c, c);
+                    break;
                 }
-              }
-      
-              // Terminator.
-              atoms.push(0);
+                variant = MiniUCD_NextCaseVariant(variant);
+            } while (variant != c);
+        }
+    }
+    return sink.nb;
+}
+
+/* End of Case Closure */
+
+
+/*******************************************************************************
+ * UTF-8 Automata
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/** Maximum length of UTF-8 sequences. */
+#define UCD_UTF8_MAXLENGTH      4
+
+/** Maximum number of pending ranges when splitting a codepoint range. */
+#define UCD_UTF8_MAXPENDING     16
+
+/**
+ * Uncompiled UTF-8 automaton node.
+ */
+struct ucdUtf8Node {
+    MiniUCD_Utf8Transition *transitions; /*!< Transitions to compiled
+                                              states. */
+    unsigned int nb;                     /*!< Number of transitions. */
+    int pending;                         /*!< Whether a transition to the
+                                              next uncompiled node is
+                                              pending. */
+    unsigned char first, last;           /*!< Byte range of pending
+                                              transition. */
+};
+
+/**
+ * UTF-8 automaton compiler.
+ *
+ * Sequences are added in ascending order. Uncompiled nodes along the last
+ * added sequence are compiled once a new sequence diverges from them, and
+ * compiled states are looked up in the output before being added, so that
+ * identical suffixes are shared.
+ */
+struct ucdUtf8Compiler {
+    MiniUCD_Utf8Transition *automaton; /*!< Compiled states. */
+    size_t size;                       /*!< Maximum number of transitions to
+                                            store. */
+    size_t nb;                         /*!< Number of transitions. */
+
+    /*! Uncompiled nodes, from the start state. */
+    struct ucdUtf8Node nodes[UCD_UTF8_MAXLENGTH+1];
+
+    int depth; /*!< Index of last uncompiled node. */
+
+    /*! Transitions of uncompiled start state, on any byte. */
+    MiniUCD_Utf8Transition start[256];
+
+    /*! Transitions of other uncompiled nodes, on continuation bytes. */
+    MiniUCD_Utf8Transition trailing[UCD_UTF8_MAXLENGTH-1][64];
+};
+
+/**
+ * Encode codepoint in UTF-8.
+ *
+ * @return Number of bytes.
+ */
+static int
+miniucdEncodeUtf8(
+    MiniUCD_Char c,      /*!< Codepoint to encode. */
+    unsigned char *utf8) /*!< [out] UTF-8 bytes. */
+{
+    if (c < 0x80) {
+        utf8[0] = (unsigned char) c;
+        return 1;
+    } else if (c < 0x800) {
+        utf8[0] = (unsigned char) (0xC0 | (c >> 6));
+        utf8[1] = (unsigned char) (0x80 | (c & 0x3F));
+        return 2;
+    } else if (c < 0x10000) {
+        utf8[0] = (unsigned char) (0xE0 | (c >> 12));
+        utf8[1] = (unsigned char) (0x80 | ((c >> 6) & 0x3F));
+        utf8[2] = (unsigned char) (0x80 | (c & 0x3F));
+        return 3;
+    }
+    utf8[0] = (unsigned char) (0xF0 | (c >> 18));
+    utf8[1] = (unsigned char) (0x80 | ((c >> 12) & 0x3F));
+    utf8[2] = (unsigned char) (0x80 | ((c >> 6) & 0x3F));
+    utf8[3] = (unsigned char) (0x80 | (c & 0x3F));
+    return 4;
+}
+
+/**
+ * Add transition to uncompiled UTF-8 automaton node, merging it with the
+ * previous one when adjacent and with the same target.
+ */
+static void
+miniucdAddUtf8Transition(
+    struct ucdUtf8Node *node, /*!< Node to add transition to. */
+    unsigned char first,      /*!< First byte of range. */
+    unsigned char last,       /*!< Last byte of range. */
+    unsigned int next)        /*!< Target. */
+{
+    MiniUCD_Utf8Transition *previous;
+    if (node->nb > 0) {
+        previous = node->transitions + node->nb-1;
+        if (previous->last+1 == first && previous->next == next) {
+            previous->last = last;
+            return;
+        }
+    }
+    node->transitions[node->nb].first = first;
+    node->transitions[node->nb].last = last;
+    node->transitions[node->nb].end = 0;
+    node->transitions[node->nb].next = next;
+    node->nb++;
+}
+
+/**
+ * Compile UTF-8 automaton state: look for an identical state among stored
+ * ones, or else add it.
+ *
+ * @return Index of state plus one.
+ */
+static unsigned int
+miniucdCompileUtf8State(
+    struct ucdUtf8Compiler *compiler,          /*!< Compiler. */
+    const MiniUCD_Utf8Transition *transitions, /*!< State transitions. */
+    unsigned int nb)                           /*!< Number of
+                                                    transitions. */
+{
+    MiniUCD_Utf8Transition *automaton = compiler->automaton;
+    size_t stored = (compiler->nb < compiler->size
+        ? compiler->nb : compiler->size);
+    size_t start, i;
+    unsigned int j;
+
+    for (start = 0; start < stored; start = i+1) {
+        for (i = start; i < stored && !automaton[i].end; i++);
+        if (i == stored) break; /* Truncated state. */
+        if (i-start+1 != nb) continue;
+        for (j = 0; j < nb; j++) {
+            if (automaton[start+j].first != transitions[j].first
+                    || automaton[start+j].last != transitions[j].last
+                    || automaton[start+j].next != transitions[j].next) break;
+        }
+        if (j == nb) return (unsigned int) start+1;
+    }
+
+    start = compiler->nb;
+    for (j = 0; j < nb; j++, compiler->nb++) {
+        if (compiler->nb >= compiler->size) continue;
+        automaton[compiler->nb] = transitions[j];
+        automaton[compiler->nb].end = (j == nb-1);
+    }
+    return (unsigned int) start+1;
+}
+
+/**
+ * Compile uncompiled UTF-8 automaton nodes past the given depth.
+ */
+static void
+miniucdCompileUtf8From(
+    struct ucdUtf8Compiler *compiler, /*!< Compiler. */
+    int depth)                        /*!< Depth of last node to keep. */
+{
+    struct ucdUtf8Node *node;
+    unsigned int next = MINIUCD_UTF8_ACCEPT;
+
+    while (compiler->depth > depth) {
+        node = compiler->nodes + compiler->depth--;
+        if (node->pending) {
+            miniucdAddUtf8Transition(node, node->first, node->last, next);
+        }
+        next = (node->nb > 0
+            ? miniucdCompileUtf8State(compiler, node->transitions, node->nb)
+            : MINIUCD_UTF8_ACCEPT);
+    }
+    node = compiler->nodes + depth;
+    if (node->pending) {
+        miniucdAddUtf8Transition(node, node->first, node->last, next);
+        node->pending = 0;
+    }
+}
+
+/**
+ * Add UTF-8 byte range sequence to automaton. Sequences must be added in
+ * ascending order.
+ */
+static void
+miniucdAddUtf8Sequence(
+    struct ucdUtf8Compiler *compiler, /*!< Compiler. */
+    const unsigned char *first,       /*!< First bytes of ranges. */
+    const unsigned char *last,        /*!< Last bytes of ranges. */
+    int length)                       /*!< Sequence length. */
+{
+    struct ucdUtf8Node *node;
+    int prefix = 0;
+
+    /* Share common prefix with last added sequence. */
+    while (prefix < length && prefix <= compiler->depth
+            && compiler->nodes[prefix].pending
+            && compiler->nodes[prefix].first == first[prefix]
+            && compiler->nodes[prefix].last == last[prefix]) {
+        prefix++;
+    }
+    miniucdCompileUtf8From(compiler, prefix);
+
+    for (; prefix < length; prefix++) {
+        node = compiler->nodes + prefix;
+        node->pending = 1;
+        node->first = first[prefix];
+        node->last = last[prefix];
+        node[1].nb = 0;
+        node[1].pending = 0;
+        compiler->depth = prefix+1;
+    }
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Compile a set of codepoint ranges to a minimal UTF-8 byte-range automaton.
+ *
+ * Ranges are sorted and disjoint pairs of first and last codepoints;
+ * surrogates are ignored. Within states, adjacent byte ranges with the same
+ * target are merged. Empty sets give a start state with a single transition
+ * matching no byte.
+ *
+ * No memory is allocated: suffixes are shared by looking up compiled states in
+ * the output buffer. When the automaton doesn't fit, the returned number is
+ * larger than @p size and is enough for a second call to succeed, but may
+ * exceed the actual size since truncated states can't be shared.
+ *
+ * @return Number of transitions of automaton.
+ */
+size_t
+MiniUCD_CompileUtf8Automaton(
+    /*! Sorted pairs of first and last codepoints. */
+    const MiniUCD_Char *ranges,
+
+    /*! Number of ranges. */
+    size_t nbRanges,
+
+    /*! [out] Automaton transitions. */
+    MiniUCD_Utf8Transition *automaton,
+
+    /*! Maximum number of transitions to store. */
+    size_t size)
+{
+    static const MiniUCD_Char maxLength[UCD_UTF8_MAXLENGTH-1] = {
+        0x7F, 0x7FF, 0xFFFF
+    };
+    struct ucdUtf8Compiler compiler;
+    MiniUCD_Char pending[UCD_UTF8_MAXPENDING*2], start, end, mask;
+    unsigned char first[UCD_UTF8_MAXLENGTH], last[UCD_UTF8_MAXLENGTH];
+    size_t i, nb;
+    int nbPending, length, k;
+
+    compiler.automaton = automaton;
+    compiler.size = size;
+    compiler.nb = 0;
+    compiler.depth = 0;
+    compiler.nodes[0].transitions = compiler.start;
+    for (k = 1; k <= UCD_UTF8_MAXLENGTH; k++) {
+        compiler.nodes[k].transitions = (k < UCD_UTF8_MAXLENGTH
+            ? compiler.trailing[k-1] : NULL);
+    }
+    compiler.nodes[0].nb = 0;
+    compiler.nodes[0].pending = 0;
+
+    for (i = 0; i < nbRanges; i++) {
+        start = ranges[i*2];
+        end = (ranges[i*2+1] < 0x10FFFF ? ranges[i*2+1] : 0x10FFFF);
+        if (start >= 0xD800 && start <= 0xDFFF) start = 0xE000;
+        if (end >= 0xD800 && end <= 0xDFFF) end = 0xD7FF;
+        if (start > end) continue;
+        nbPending = 0;
+        if (start < 0xD800 && end > 0xDFFF) {
+            pending[nbPending*2] = 0xE000;
+            pending[nbPending*2+1] = end;
+            nbPending++;
+            end = 0xD7FF;
+        }
+        pending[nbPending*2] = start;
+        pending[nbPending*2+1] = end;
+        nbPending++;
+
+        while (nbPending > 0) {
+            nbPending--;
+            start = pending[nbPending*2];
+            end = pending[nbPending*2+1];
+            for (;;) {
+                /* Split at encoded length boundaries. */
+                for (k = 0; k < UCD_UTF8_MAXLENGTH-1; k++) {
+                    if (start <= maxLength[k] && maxLength[k] < end) break;
+                }
+                if (k < UCD_UTF8_MAXLENGTH-1) {
+                    pending[nbPending*2] = maxLength[k]+1;
+                    pending[nbPending*2+1] = end;
+                    nbPending++;
+                    end = maxLength[k];
+                    continue;
+                }
+
+                /* Split so that trailing bytes span full continuation
+                 * ranges. */
+                for (k = 1; k < UCD_UTF8_MAXLENGTH; k++) {
+                    mask = ((MiniUCD_Char) 1 << (6*k)) - 1;
+                    if ((start & ~mask) == (end & ~mask)) continue;
+                    if ((start & mask) != 0) {
+                        pending[nbPending*2] = (start | mask)+1;
+                        pending[nbPending*2+1] = end;
+                        nbPending++;
+                        end = start | mask;
+                        break;
+                    }
+                    if ((end & mask) != mask) {
+                        pending[nbPending*2] = end & ~mask;
+                        pending[nbPending*2+1] = end;
+                        nbPending++;
+                        end = (end & ~mask)-1;
+                        break;
+                    }
+                }
+                if (k < UCD_UTF8_MAXLENGTH) continue;
+
+                length = miniucdEncodeUtf8(start, first);
+                miniucdEncodeUtf8(end, last);
+                miniucdAddUtf8Sequence(&compiler, first, last, length);
+                break;
             }
-%> */
-static const int ucdAtoms_<%- property %>[] = {<%-
-  formatArrayValues(atoms, 16)
-%>};
-<%
-            break;
-          }
+        }
+    }
+    miniucdCompileUtf8From(&compiler, 0);
 
-          case "enumList":{
-            // Zero-terminated list of enum values.
-            const elementProperty = info.enumType;
-            const ElementProperty = capitalize(elementProperty);
-            const ELEMENT_PROPERTY = elementProperty.toUpperCase();
-            const nbValues = properties[elementProperty].values.length;
-            const valueType =
-              nbValues < 256 ? "char" : nbValues < 65536 ? "short" : "int";
-            const atomType = `unsigned ${valueType}`;
-            const atoms = [];
-            for (const value of uniqueValues) {
-              if (Array.isArray(value)) {
-                atoms.push(...value);
-              } else {
-                atoms.push(value);
-              }
+    if (compiler.nodes[0].nb == 0) {
+        /* Empty set. */
+        miniucdAddUtf8Transition(compiler.nodes, 1, 0, MINIUCD_UTF8_ACCEPT);
+    }
+    compiler.start[compiler.nodes[0].nb-1].end = 1;
+
+    /* Move start state in front. */
+    nb = compiler.nb + compiler.nodes[0].nb;
+    if (nb > size) return nb;
+    memmove(automaton + compiler.nodes[0].nb, automaton,
+        compiler.nb * sizeof(*automaton));
+    memcpy(automaton, compiler.start,
+        compiler.nodes[0].nb * sizeof(*automaton));
+    for (i = 0; i < nb; i++) {
+        if (automaton[i].next != MINIUCD_UTF8_ACCEPT) {
+            automaton[i].next += compiler.nodes[0].nb-1;
+        }
+    }
+    return nb;
+}
+
+/**
+ * Match the beginning of UTF-8 text against an automaton.
+ *
+ * @return Length in bytes of the matched sequence, or zero if none.
+ */
+size_t
+MiniUCD_MatchUtf8Automaton(
+    const MiniUCD_Utf8Transition *automaton, /*!< Automaton. */
+    const unsigned char *utf8,               /*!< UTF-8 text. */
+    size_t length)                           /*!< Length in bytes. */
+{
+    const MiniUCD_Utf8Transition *transition = automaton;
+    size_t i;
+
+    for (i = 0; i < length; i++) {
+        while (utf8[i] > transition->last && !transition->end) transition++;
+        if (utf8[i] < transition->first || utf8[i] > transition->last) break;
+        if (transition->next == MINIUCD_UTF8_ACCEPT) return i+1;
+        transition = automaton + transition->next;
+    }
+    return 0;
+}
+
+/* End of UTF-8 Automata */
+
+
+/*******************************************************************************
+ * Character Types
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Get character type mask for given codepoint.
+ *
+ * @return Character type mask.
+ *
+ * @see ucdMasks_ctype
+ */
+static int
+miniucdGetCtype(
+    MiniUCD_Char c,              /*!< Codepoint to get mask for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
+{
+    if (c < 0x80) return ucdMasks_ctype[ucdAscii_ctype[c]];
+    return ucdMasks_ctype[ucdValues_ctype[miniucdGetRangeCursor(c, ucdRanges_ctype, UCD_NBRANGES_CTYPE, cursor)]];
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Get the character types of a codepoint.
+ *
+ * @return Combination of MINIUCD_CTYPE_* flags.
+ */
+int
+MiniUCD_GetCtype(
+    MiniUCD_Char c) /*!< Codepoint to classify. */
+{
+    if (c < 0x80) return ucdMasks_ctype[ucdAscii_ctype[c]];
+    return ucdMasks_ctype[ucdValues_ctype[miniucdGetRange(c, ucdRanges_ctype, UCD_NBRANGES_CTYPE)]];
+}
+
+/**
+ * Get the character types of all codepoints of a text.
+ *
+ * Runs of codepoints falling within the same range of the class table, the
+ * common case in running text, only need one binary search.
+ */
+void
+MiniUCD_GetCtypes(
+    const MiniUCD_Char *text, /*!< Text to classify. */
+    size_t length,            /*!< Number of codepoints. */
+    unsigned short *masks)    /*!< [out] Combinations of MINIUCD_CTYPE_*
+                                   flags, one per codepoint. */
+{
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    size_t i;
+    for (i = 0; i < length; i++) {
+        masks[i] = (unsigned short) miniucdGetCtype(text[i], &cursor);
+    }
+}
+
+/**
+ * Find the first codepoint having any of the given character types.
+ *
+ * @return Index of codepoint, or @p length if none.
+ */
+size_t
+MiniUCD_ScanCtype(
+    const MiniUCD_Char *text, /*!< Text to scan. */
+    size_t length,            /*!< Number of codepoints. */
+    int mask)                 /*!< Combination of MINIUCD_CTYPE_* flags. */
+{
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    size_t i;
+    for (i = 0; i < length; i++) {
+        if (miniucdGetCtype(text[i], &cursor) & mask) break;
+    }
+    return i;
+}
+
+/**
+ * Find the first codepoint having none of the given character types.
+ *
+ * @return Index of codepoint, or @p length if none.
+ */
+size_t
+MiniUCD_ScanNotCtype(
+    const MiniUCD_Char *text, /*!< Text to scan. */
+    size_t length,            /*!< Number of codepoints. */
+    int mask)                 /*!< Combination of MINIUCD_CTYPE_* flags. */
+{
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    size_t i;
+    for (i = 0; i < length; i++) {
+        if (!(miniucdGetCtype(text[i], &cursor) & mask)) break;
+    }
+    return i;
+}
+
+/* End of Character Types */
+
+
+/*******************************************************************************
+ * Property Spans
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Test ASCII character against set bitmap.
+ *
+ * @see MiniUCD_Set
+ */
+#define UCD_SET_ASCII(set, b)   ((int) ((set)->ascii[(b) >> 5] >> ((b) & 31)) & 1)
+
+/**
+ * Test whether a non-ASCII codepoint belongs to a set.
+ *
+ * The range found last is tried first, so that runs of codepoints falling
+ * within the same range skip the binary search.
+ *
+ * @return Nonzero if member.
+ */
+static int
+miniucdSetContains(
+    const MiniUCD_Set *set, /*!< Set to test. */
+    MiniUCD_Char c,         /*!< Codepoint to test. */
+    size_t *hint)           /*!< [in,out] Index of last range found. */
+{
+    const MiniUCD_Char *ranges = set->ranges;
+    size_t first = 0, last = set->nbRanges, middle;
+
+    if (*hint < set->nbRanges && c >= ranges[*hint*2]
+            && c <= ranges[*hint*2+1]) {
+        return 1;
+    }
+    while (first < last) {
+        middle = (first+last)/2;
+        if (c > ranges[middle*2+1]) {
+            first = middle+1;
+        } else {
+            last = middle;
+        }
+    }
+    if (first == set->nbRanges || c < ranges[first*2]) return 0;
+    *hint = first;
+    return 1;
+}
+
+/**
+ * Membership test for UTF-8 spans: either a set or a General Category mask.
+ *
+ * @see miniucdSpanMatch
+ */
+struct ucdSpanTest {
+    const MiniUCD_Set *set;     /*!< Set to test, or NULL to test **mask**. */
+    unsigned long mask;         /*!< Combination of MINIUCD_GC_MASK_* masks. */
+    size_t hint;                /*!< Set lookup hint. */
+    MiniUCD_RangeCursor cursor; /*!< General Category lookup cursor. */
+};
+
+/**
+ * Test whether a codepoint matches a span test.
+ *
+ * @return Nonzero if match.
+ */
+static int
+miniucdSpanMatch(
+    struct ucdSpanTest *test, /*!< [in,out] Test. */
+    MiniUCD_Char c)           /*!< Codepoint to test. */
+{
+    if (test->set) {
+        if (c < 0x80) return UCD_SET_ASCII(test->set, c);
+        return miniucdSetContains(test->set, c, &test->hint);
+    }
+    return (miniucdGetGcMask(c, &test->cursor) & test->mask) != 0;
+}
+
+/**
+ * Span UTF-8 text over codepoints that match (or don't match) a test.
+ *
+ * Invalid UTF-8 bytes never match.
+ *
+ * @return Length of leading span in bytes.
+ */
+static size_t
+miniucdSpanForward(
+    struct ucdSpanTest *test,  /*!< [in,out] Test. */
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    int contained)             /*!< Nonzero to span over matches, zero to
+                                    span over others. */
+{
+    size_t i = 0, n;
+    MiniUCD_Char c;
+
+    contained = (contained != 0);
+    while (i < length) {
+        if (utf8[i] < 0x80) {
+            c = utf8[i];
+            n = 1;
+        } else if (!(n = miniucdDecodeUtf8(utf8+i, length-i, &c))) {
+            /* Invalid byte. */
+            if (contained) break;
+            i++;
+            continue;
+        }
+        if (miniucdSpanMatch(test, c) != contained) break;
+        i += n;
+    }
+    return i;
+}
+
+/**
+ * Span UTF-8 text backwards over codepoints that match (or don't match) a
+ * test.
+ *
+ * Invalid UTF-8 bytes never match.
+ *
+ * @return Offset of trailing span in bytes.
+ */
+static size_t
+miniucdSpanBackward(
+    struct ucdSpanTest *test,  /*!< [in,out] Test. */
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    int contained)             /*!< Nonzero to span over matches, zero to
+                                    span over others. */
+{
+    size_t end = length, j;
+    MiniUCD_Char c;
 
-              // Terminator.
-              atoms.push(0);
+    contained = (contained != 0);
+    while (end > 0) {
+        if (utf8[end-1] < 0x80) {
+            c = utf8[end-1];
+            j = end-1;
+        } else {
+            /* Find start of last character. */
+            j = end-1;
+            while (j > 0 && end-j < 4 && (utf8[j] & 0xC0) == 0x80) j--;
+            if (miniucdDecodeUtf8(utf8+j, end-j, &c) != end-j) {
+                /* Invalid byte. */
+                if (contained) break;
+                end--;
+                continue;
             }
-%> * @see MiniUCD_<%- ElementProperty %>
+        }
+        if (miniucdSpanMatch(test, c) != contained) break;
+        end = j;
+    }
+    return end;
+}
+
+/** @endcond @endprivate */
+
+/**
+ * Initialize set from codepoint ranges.
+ *
+ * @see MiniUCD_GetPropertyRanges
  */
-static const unsigned <%- valueType %> ucdAtoms_<%- property %>[] = {<%-
-  formatArrayValues(
-    atoms.map(
-      atom =>
-      atom === 0 ? 0 : `MINIUCD_${ELEMENT_PROPERTY}_${toConstant(atom)}`
-    ),
-  4)
-%>};
-<%      
-            break;
-          }
+void
+MiniUCD_InitSet(
+    MiniUCD_Set *set,           /*!< [out] Set to initialize. */
+    const MiniUCD_Char *ranges, /*!< Sorted, disjoint codepoint ranges as
+                                     first/last pairs. */
+    size_t nbRanges)            /*!< Number of ranges. */
+{
+    size_t i;
+    MiniUCD_Char c;
+
+    memset(set->ascii, 0, sizeof(set->ascii));
+    for (i = 0; i < nbRanges && ranges[i*2] < 0x80; i++) {
+        for (c = ranges[i*2]; c <= ranges[i*2+1] && c < 0x80; c++) {
+            set->ascii[c >> 5] |= 1UL << (c & 31);
         }
-        break;
-      }
     }
-%>
-<%      
-  }
-%>/** @endcond @endprivate */
+    set->ranges = ranges;
+    set->nbRanges = nbRanges;
+}
 
-/* End of Compiled UCD Data *//*!\}*/
+/**
+ * Span UTF-8 text over codepoints that belong (or don't belong) to a set.
+ *
+ * @return Length of leading span in bytes.
+ *
+ * @see MiniUCD_SpanBack
+ */
+size_t
+MiniUCD_Span(
+    const MiniUCD_Set *set,    /*!< Set to span over. */
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    int contained)             /*!< Nonzero to span over members, zero to
+                                    span over non-members. */
+{
+    struct ucdSpanTest test;
+
+    test.set = set;
+    test.hint = 0;
+    return miniucdSpanForward(&test, utf8, length, contained);
+}
+
+/**
+ * Span UTF-8 text backwards over codepoints that belong (or don't belong) to
+ * a set.
+ *
+ * @return Offset of trailing span in bytes.
+ *
+ * @see MiniUCD_Span
+ */
+size_t
+MiniUCD_SpanBack(
+    const MiniUCD_Set *set,    /*!< Set to span over. */
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    int contained)             /*!< Nonzero to span over members, zero to
+                                    span over non-members. */
+{
+    struct ucdSpanTest test;
+
+    test.set = set;
+    test.hint = 0;
+    return miniucdSpanBackward(&test, utf8, length, contained);
+}
+
+/* End of Property Spans */
 
 
 /*******************************************************************************
- * UCD Property Accessors
+ * Changes-When Scanners
  ******************************************************************************/
 
 /** @beginprivate @cond PRIVATE */
 
 /**
- * Get the range index containing the given codepoint.
+ * Get changes-when mask for given codepoint.
  *
- * @return Range index.*/
+ * @return Changes-when mask.
+ *
+ * @see ucdMasks_changesWhen
+ */
 static int
-miniucdGetRange(
-    MiniUCD_Char c,             /*!< Codepoint to lookup. */
-    const MiniUCD_Char *ranges, /*!< Array of ranges boundaries. First one is
-                                     omitted (first codepoint is always zero).*/
-    int nbRanges)               /*!< Number of ranges. */
+miniucdGetChangesWhen(
+    MiniUCD_Char c,              /*!< Codepoint to get mask for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
 {
-    int min, max;
-    if (c < ranges[0] || nbRanges < 2) return 0;
-    if (c >= ranges[nbRanges-2]) return nbRanges-1;
-    for (min=1, max=nbRanges-1; max-min > 1;) {
-        int mid = min+((max-min)>>1);
-        if (c < ranges[mid-1]) max = mid;
-        else min = mid;
-    }
-    return min;
+    if (c < 0x80) return ucdMasks_changesWhen[ucdAscii_changesWhen[c]];
+    return ucdMasks_changesWhen[ucdValues_changesWhen[miniucdGetRangeCursor(c, ucdRanges_changesWhen, UCD_NBRANGES_CHANGESWHEN, cursor)]];
 }
 
 /** @endcond @endprivate */
-<%
-  //
-  // Now generate accessors for all known properties
-  //
-
-  for (const [property, info] of Object.entries(properties)) {
-    if (!info || ["deprecated", "name"].includes(info.type)) continue;
 
-    const Property = capitalize(property);
-    const PROPERTY = property.toUpperCase();
-%>
 /**
- * Get value of UCD property '**<%- property %>**' for given codepoint.
- *<%
-    switch (info.type) {
-      case "boolean":
-%>
- * @return Value of UCD property '**<%- property %>**'.
+ * Get the transforms that change a codepoint.
  *
- * @see MINIUCD_<%- PROPERTY %>
+ * @return Combination of MINIUCD_CW_* flags.
  */
 int
-MiniUCD_GetProperty_<%- Property %>(
-    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+MiniUCD_GetChangesWhen(
+    MiniUCD_Char c) /*!< Codepoint to test. */
 {
-    return (miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)%2)
-        ? !UCD_VALUE_0_<%- PROPERTY %>
-        : UCD_VALUE_0_<%- PROPERTY %>;
+    if (c < 0x80) return ucdMasks_changesWhen[ucdAscii_changesWhen[c]];
+    return ucdMasks_changesWhen[ucdValues_changesWhen[miniucdGetRange(c, ucdRanges_changesWhen, UCD_NBRANGES_CHANGESWHEN)]];
 }
-<%
-        break;
 
-      case "enum":
-%>
- * @return Value of UCD property '**<%- property %>**'.
+/**
+ * Find the first character of UTF-8 text changed by any of the given
+ * transforms.
  *
- * @see MINIUCD_<%- PROPERTY %>
- * @see MiniUCD_<%- Property %>
+ * ASCII bytes are tested a machine word at a time against the hull of the
+ * byte ranges of the transforms.
+ *
+ * @return Offset of character in bytes, or @p length if none.
  */
-MiniUCD_<%- Property %>
-MiniUCD_GetProperty_<%- Property %>(
-    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+size_t
+MiniUCD_FirstChangedWhen(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    int mask)                  /*!< Combination of MINIUCD_CW_* flags. */
 {
-    return ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)];
+    size_t i = 0, n, word;
+    unsigned char bounds[4] = {0x7F, 0, 0x7F, 0};
+    int flag, j;
+    MiniUCD_Char c;
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+
+    for (flag = 0; flag < MINIUCD_CW_NBFLAGS; flag++) {
+        if (!(mask & (1 << flag))) continue;
+        for (j = 0; j < 4; j += 2) {
+            if (ucdAsciiBounds_changesWhen[flag][j]
+                    > ucdAsciiBounds_changesWhen[flag][j+1]) {
+                continue;
+            }
+            if (ucdAsciiBounds_changesWhen[flag][j] < bounds[j]) {
+                bounds[j] = ucdAsciiBounds_changesWhen[flag][j];
+            }
+            if (ucdAsciiBounds_changesWhen[flag][j+1] > bounds[j+1]) {
+                bounds[j+1] = ucdAsciiBounds_changesWhen[flag][j+1];
+            }
+        }
+    }
+    for (j = 0; j < 4; j += 2) {
+        if (bounds[j] > bounds[j+1]) {
+            /* Empty range. */
+            bounds[j] = 1;
+            bounds[j+1] = 0;
+        }
+    }
+
+    while (i < length) {
+        /* Skip unchanged ASCII words. */
+        for (; i + sizeof(word) <= length; i += sizeof(word)) {
+            memcpy(&word, utf8+i, sizeof(word));
+            if (UCD_WORD_HAS_MORE(word, 0x7F)
+                    | UCD_WORD_HAS_BETWEEN(word, bounds[0]-1, bounds[1]+1)
+                    | UCD_WORD_HAS_BETWEEN(word, bounds[2]-1, bounds[3]+1)) {
+                break;
+            }
+        }
+        if (i == length) break;
+
+        n = miniucdDecodeUtf8(utf8+i, length-i, &c);
+        if (!n) {
+            /* Invalid byte. */
+            i++;
+            continue;
+        }
+        if (miniucdGetChangesWhen(c, &cursor) & mask) break;
+        i += n;
+    }
+    return i;
 }
-<%
-        break;
 
-      case "cp":
-%>
- * @return Value of UCD property '**<%- property %>**'.
+/**
+ * Find the first character of UTF-8 text changed by lowercasing.
  *
- * @see MINIUCD_<%- PROPERTY %>
+ * @return Offset of character in bytes, or @p length if none.
+ *
+ * @see MiniUCD_FirstChangedWhen
  */
-MiniUCD_Char
-MiniUCD_GetProperty_<%- Property %>(
-    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+size_t
+MiniUCD_FirstChangedWhenLowercased(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length)             /*!< Length of text in bytes. */
 {
-    return c+ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)];
+    return MiniUCD_FirstChangedWhen(utf8, length, MINIUCD_CW_LOWERCASED);
 }
-<%
-        break;
 
-      case "numeric":
-%>
- * @return Value of UCD property '**<%- property %>**'.
+/**
+ * Find the first character of UTF-8 text changed by uppercasing.
  *
- * @see MINIUCD_<%- PROPERTY %>
+ * @return Offset of character in bytes, or @p length if none.
+ *
+ * @see MiniUCD_FirstChangedWhen
  */
-const char *
-MiniUCD_GetProperty_<%- Property %>(
-    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+size_t
+MiniUCD_FirstChangedWhenUppercased(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length)             /*!< Length of text in bytes. */
 {
-    return ucdAtoms_<%- property %>[ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)]];
+    return MiniUCD_FirstChangedWhen(utf8, length, MINIUCD_CW_UPPERCASED);
 }
-<%
-        break;
 
-      case "string":
-%>
- * @return Value of UCD property '**<%- property %>**'.
+/**
+ * Find the first character of UTF-8 text changed by titlecasing.
  *
- * @see MINIUCD_<%- PROPERTY %>
+ * @return Offset of character in bytes, or @p length if none.
+ *
+ * @see MiniUCD_FirstChangedWhen
  */
-const char *
-MiniUCD_GetProperty_<%- Property %>(
-    MiniUCD_Char c) /*!< Codepoint to get UCD property value for. */
+size_t
+MiniUCD_FirstChangedWhenTitlecased(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length)             /*!< Length of text in bytes. */
 {
-    return ucdAtoms_<%- property %>[ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)]];
+    return MiniUCD_FirstChangedWhen(utf8, length, MINIUCD_CW_TITLECASED);
 }
-<%
-        break;
 
-      case "mcp":
-%>
- * @return Beginning of value list for UCD property '**<%- property %>**'.
+/**
+ * Find the first character of UTF-8 text changed by case folding.
  *
- * If list length is 1, the first entry gives the offset from the input
- * codepoint to get the actual single-value codepoint. Else, list entries give
- * codepoint values that can be safely cast to MiniUCD_Char.
+ * @return Offset of character in bytes, or @p length if none.
  *
- * @see MINIUCD_<%- PROPERTY %>
+ * @see MiniUCD_FirstChangedWhen
  */
-const int *
-MiniUCD_GetProperty_<%- Property %>(
-    MiniUCD_Char c, /*!< Codepoint to get UCD property value for. */
+size_t
+MiniUCD_FirstChangedWhenCasefolded(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length)             /*!< Length of text in bytes. */
+{
+    return MiniUCD_FirstChangedWhen(utf8, length, MINIUCD_CW_CASEFOLDED);
+}
 
-    /*! [out] Value list length. */
-    size_t *lengthPtr)
+/**
+ * Find the first character of UTF-8 text changed by any case mapping.
+ *
+ * @return Offset of character in bytes, or @p length if none.
+ *
+ * @see MiniUCD_FirstChangedWhen
+ */
+size_t
+MiniUCD_FirstChangedWhenCasemapped(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length)             /*!< Length of text in bytes. */
 {
-    const int *first = ucdAtoms_<%- property %> + ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)],
-        *last = first;
-    while (*last != 0) last++;
-    *lengthPtr = last-first;
-    return first;
+    return MiniUCD_FirstChangedWhen(utf8, length, MINIUCD_CW_CASEMAPPED);
 }
-<%
-        break;
 
-      case "enumList":
-        const elementProperty = info.enumType;
-        const ElementProperty = capitalize(elementProperty);
-        const nbValues = properties[elementProperty]?.values?.length || 0;
-        const valueType = nbValues < 256 ? "char" : nbValues < 65536 ? "short" : "int";
-%>
- * @return Beginning of value list for UCD property '**<%- property %>**'.
+/**
+ * Find the first character of UTF-8 text changed by NFKC case folding.
  *
- * Entries can be safely cast to #MiniUCD_<%- ElementProperty %>.
+ * @return Offset of character in bytes, or @p length if none.
  *
- * @see MINIUCD_<%- PROPERTY %>
- * @see MiniUCD_<%- ElementProperty %>
+ * @see MiniUCD_FirstChangedWhen
  */
-const unsigned <%- valueType %> *
-MiniUCD_GetProperty_<%- Property %>(
-    MiniUCD_Char c, /*!< Codepoint to get UCD property value for. */
+size_t
+MiniUCD_FirstChangedWhenNFKCCasefolded(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length)             /*!< Length of text in bytes. */
+{
+    return MiniUCD_FirstChangedWhen(utf8, length, MINIUCD_CW_NFKC_CASEFOLDED);
+}
 
-    /*! [out] Value list length. */
-    size_t *lengthPtr)
+/* End of Changes-When Scanners */
+
+
+/*******************************************************************************
+ * General Category Masks
+ ******************************************************************************/
+
+/** @beginprivate @cond PRIVATE */
+
+/**
+ * Get General Category mask for given codepoint.
+ *
+ * @return General Category mask.
+ *
+ * @see ucdAscii_gc
+ */
+static unsigned long
+miniucdGetGcMask(
+    MiniUCD_Char c,              /*!< Codepoint to get mask for. */
+    MiniUCD_RangeCursor *cursor) /*!< [in,out] Lookup cursor. */
 {
-    const unsigned <%- valueType %>
-        *first = ucdAtoms_<%- property %> + ucdValues_<%- property %>[miniucdGetRange(c, ucdRanges_<%- property %>, UCD_NBRANGES_<%- PROPERTY %>)],
-        *last = first;
-    while (*last != 0) last++;
-    *lengthPtr = last-first;
-    return first;
+    if (c < 0x80) return 1UL << ucdAscii_gc[c];
+    return 1UL << ucdValues_gc[miniucdGetRangeCursor(c, ucdRanges_gc, UCD_NBRANGES_GC, cursor)];
 }
-<%
-        break;
+
+/** @endcond @endprivate */
+
+/**
+ * Get the General Category mask of a codepoint.
+ *
+ * @return One of the MINIUCD_GC_MASK_* value masks.
+ */
+unsigned long
+MiniUCD_GetGcMask(
+    MiniUCD_Char c) /*!< Codepoint to get mask for. */
+{
+    if (c < 0x80) return 1UL << ucdAscii_gc[c];
+    return 1UL << ucdValues_gc[miniucdGetRange(c, ucdRanges_gc, UCD_NBRANGES_GC)];
+}
+
+/**
+ * Get the General Category masks of all codepoints of a text.
+ */
+void
+MiniUCD_GetGcMasks(
+    const MiniUCD_Char *text, /*!< Text to get masks for. */
+    size_t length,            /*!< Number of codepoints. */
+    unsigned long *masks)     /*!< [out] MINIUCD_GC_MASK_* value masks, one
+                                   per codepoint. */
+{
+    MiniUCD_RangeCursor cursor = {1, 0, 0};
+    size_t i;
+    for (i = 0; i < length; i++) {
+        masks[i] = miniucdGetGcMask(text[i], &cursor);
     }
-  }
-%>
-/* End of UCD Property Accessors */
+}
+
+/**
+ * Span UTF-8 text over characters whose General Category is (or is not) in
+ * a mask, e.g. #MINIUCD_GC_MASK_L for letters.
+ *
+ * Invalid UTF-8 bytes never match the mask.
+ *
+ * @return Length of leading span in bytes.
+ *
+ * @see MiniUCD_SpanBackGcMask
+ */
+size_t
+MiniUCD_SpanGcMask(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    unsigned long mask,        /*!< Combination of MINIUCD_GC_MASK_* masks. */
+    int contained)             /*!< Nonzero to span over matching
+                                    characters, zero to span over others. */
+{
+    struct ucdSpanTest test;
+
+    test.set = NULL;
+    test.mask = mask;
+    test.cursor.first = 1;
+    test.cursor.last = 0;
+    test.cursor.index = 0;
+    return miniucdSpanForward(&test, utf8, length, contained);
+}
+
+/**
+ * Span UTF-8 text backwards over characters whose General Category is (or is
+ * not) in a mask.
+ *
+ * Invalid UTF-8 bytes never match the mask.
+ *
+ * @return Offset of trailing span in bytes.
+ *
+ * @see MiniUCD_SpanGcMask
+ */
+size_t
+MiniUCD_SpanBackGcMask(
+    const unsigned char *utf8, /*!< UTF-8 text. */
+    size_t length,             /*!< Length of text in bytes. */
+    unsigned long mask,        /*!< Combination of MINIUCD_GC_MASK_* masks. */
+    int contained)             /*!< Nonzero to span over matching
+                                    characters, zero to span over others. */
+{
+    struct ucdSpanTest test;
+
+    test.set = NULL;
+    test.mask = mask;
+    test.cursor.first = 1;
+    test.cursor.last = 0;
+    test.cursor.index = 0;
+    return miniucdSpanBackward(&test, utf8, length, contained);
+}
+
+/* End of General Category Masks */
 
 #endif /* MINIUCD_IMPLEMENTATION */
 
@@ -0,0 +1,496 @@
+/**
+ * @file miniucd.hpp
+ *
+ * This file provides C++ locale and regular expression support on top of
+ * miniucd.h, for the Unicode Character Database (UCD) version <%- version %>.
+ *
+ * The C implementation is declared here with C linkage and must be compiled
+ * separately as C, i.e. by a C file including miniucd.h with
+ * MINIUCD_IMPLEMENTATION defined.
+ *
+ * As it specializes standard library templates, it must be opted in by
+ * defining MINIUCD_STD_SPECIALIZATIONS before inclusion.
+ *
+ * It is automatically generated from the UCD source files using the script
+ * `ucdGenerate.js`; Do not modify.
+ */
+
+#ifndef _MINIUCD_HPP
+#define _MINIUCD_HPP
+
+#ifndef MINIUCD_STD_SPECIALIZATIONS
+#   error "miniucd.hpp specializes std::ctype<char32_t> and std::regex_traits<char32_t>; define MINIUCD_STD_SPECIALIZATIONS to opt in"
+#endif
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <locale>
+#include <regex>
+#include <string>
+
+extern "C" {
+#include "miniucd.h"
+}
+
+
+/***************************************************************************//*!
+ * \defgroup cpp C++ Support
+ *
+ * Unicode-aware `std::ctype<char32_t>` facet and `std::regex_traits<char32_t>`
+ * specialization, so that `std::basic_regex<char32_t>` and locale-based code
+ * classify non-ASCII text by Unicode properties rather than by the C locale.
+ *
+ * Patterns are scanned with the `std::ctype<char32_t>` facet of the regex
+ * locale, which defaults to the global locale, so the facet must be installed
+ * there first, e.g.:
+ *
+ * @code
+ * #define MINIUCD_STD_SPECIALIZATIONS
+ * #include "miniucd.hpp"
+ *
+ * std::locale::global(miniucd::withCtype(std::locale()));
+ * std::basic_regex<char32_t> re(U"[[:alpha:]]+|[[:Greek:]]");
+ * @endcode
+ *
+ * Character types come from MiniUCD_GetCtype() and its bulk variants, so
+ * that a single lookup gives all types of a codepoint; case conversions
+ * follow the simple case mappings. Regular expression classes also accept
+ * General Category values and groups (e.g. `[[:Lu:]]` or `[[:L:]]`) and
+ * Script values (e.g. `[[:Greek:]]`), matched loosely.
+ *
+ * @warning The standard ([namespace.std]) only allows specializing standard
+ * library templates for program-defined types, so these specializations for
+ * `char32_t` are formally undefined behavior. They work with libstdc++ and
+ * libc++, which provide neither, but would conflict with a library that
+ * does. They are therefore only available when MINIUCD_STD_SPECIALIZATIONS
+ * is defined before including this file.
+ ***************************************************************************\{*/
+
+namespace miniucd {
+
+/** @beginprivate @cond PRIVATE */
+namespace detail {
+
+/**
+ * Facet identifier. Static data members of class templates can be defined
+ * in headers, unlike those of explicit specializations such as
+ * `std::ctype<char32_t>` before C++17.
+ */
+template<typename Facet>
+struct FacetId {
+    static std::locale::id id; /*!< Identifier. */
+};
+template<typename Facet>
+std::locale::id FacetId<Facet>::id;
+
+/*
+ * Bit offsets of regular expression classes: character types, then General
+ * Category values, then Script values.
+ */
+const std::size_t CLASS_CTYPE = 0;
+const std::size_t CLASS_GC = CLASS_CTYPE+MINIUCD_CTYPE_NBFLAGS;
+const std::size_t CLASS_SC = CLASS_GC+MINIUCD_GC_NBVALUES+1;
+const std::size_t NBCLASSES = CLASS_SC+MINIUCD_SC_NBVALUES+1;
+
+/** Maximum length of regular expression class names. */
+const std::size_t CLASSNAME_MAXLENGTH = 64;
+
+/**
+ * Value masks of General Category groups. Group values follow
+ * #MINIUCD_GC_NBVALUES.
+ *
+ * Automatically generated from the UCD file `PropertyValueAliases.txt`.
+ */
+const unsigned long gcGroups[] = {<%
+  for (const { aliases, members } of properties.gc.groups) {
+%>
+    /* <%- aliases.join(", ") %> */
+    <%- members
+      .map((member) => `(1UL<<MINIUCD_GC_${toConstant(member)})`)
+      .map((bit, index) => (index > 0 && index % 3 === 0 ? "\n    " : "") + bit)
+      .join("|") %>,<%
+  }
+%>
+};
+
+} /* namespace detail */
+/** @endcond @endprivate */
+
+} /* namespace miniucd */
+
+namespace std {
+
+/**
+ * Unicode-aware character classification facet for `char32_t`.
+ *
+ * The bulk members classify whole arrays with MiniUCD_GetCtypes(),
+ * MiniUCD_ScanCtype() and MiniUCD_ScanNotCtype(), which only need one
+ * binary search per run of codepoints of the same class.
+ *
+ * When `ctype_base::graph` is a combination of other types, as with
+ * libstdc++ where it is alpha|digit|punct, it misses marks and non-decimal
+ * numbers; `std::regex_traits<char32_t>` is not affected.
+ */
+template<>
+class ctype<char32_t> : public locale::facet, public ctype_base,
+        public miniucd::detail::FacetId<ctype<char32_t> > {
+public:
+    typedef char32_t char_type; /*!< Character type. */
+
+    /** Constructor. */
+    explicit ctype(size_t refs = 0) : locale::facet(refs) {}
+
+    /*
+     * Public interface, see std::ctype.
+     */
+    bool is(mask m, char_type c) const { return do_is(m, c); }
+    const char_type * is(const char_type *low, const char_type *high,
+            mask *vec) const { return do_is(low, high, vec); }
+    const char_type * scan_is(mask m, const char_type *low,
+            const char_type *high) const { return do_scan_is(m, low, high); }
+    const char_type * scan_not(mask m, const char_type *low,
+            const char_type *high) const { return do_scan_not(m, low, high); }
+    char_type toupper(char_type c) const { return do_toupper(c); }
+    const char_type * toupper(char_type *low, const char_type *high) const {
+        return do_toupper(low, high);
+    }
+    char_type tolower(char_type c) const { return do_tolower(c); }
+    const char_type * tolower(char_type *low, const char_type *high) const {
+        return do_tolower(low, high);
+    }
+    char_type widen(char c) const { return do_widen(c); }
+    const char * widen(const char *low, const char *high,
+            char_type *to) const { return do_widen(low, high, to); }
+    char narrow(char_type c, char dfault) const {
+        return do_narrow(c, dfault);
+    }
+    const char_type * narrow(const char_type *low, const char_type *high,
+            char dfault, char *to) const {
+        return do_narrow(low, high, dfault, to);
+    }
+
+protected:
+    virtual ~ctype() {}
+
+    virtual bool do_is(mask m, char_type c) const {
+        return (toMask(MiniUCD_GetCtype(c)) & m) != 0;
+    }
+    virtual const char_type * do_is(const char_type *low,
+            const char_type *high, mask *vec) const {
+        unsigned short masks[256];
+        size_t length, i;
+        for (; low < high; low += length, vec += length) {
+            length = (size_t) (high-low);
+            if (length > 256) length = 256;
+            MiniUCD_GetCtypes(reinterpret_cast<const MiniUCD_Char *>(low),
+                length, masks);
+            for (i = 0; i < length; i++) vec[i] = toMask(masks[i]);
+        }
+        return high;
+    }
+    virtual const char_type * do_scan_is(mask m, const char_type *low,
+            const char_type *high) const {
+        return low + MiniUCD_ScanCtype(
+            reinterpret_cast<const MiniUCD_Char *>(low),
+            (size_t) (high-low), fromMask(m));
+    }
+    virtual const char_type * do_scan_not(mask m, const char_type *low,
+            const char_type *high) const {
+        return low + MiniUCD_ScanNotCtype(
+            reinterpret_cast<const MiniUCD_Char *>(low),
+            (size_t) (high-low), fromMask(m));
+    }
+    virtual char_type do_toupper(char_type c) const {
+        return MiniUCD_GetProperty_Suc(c);
+    }
+    virtual const char_type * do_toupper(char_type *low,
+            const char_type *high) const {
+        for (; low < high; low++) *low = MiniUCD_GetProperty_Suc(*low);
+        return high;
+    }
+    virtual char_type do_tolower(char_type c) const {
+        return MiniUCD_GetProperty_Slc(c);
+    }
+    virtual const char_type * do_tolower(char_type *low,
+            const char_type *high) const {
+        for (; low < high; low++) *low = MiniUCD_GetProperty_Slc(*low);
+        return high;
+    }
+    virtual char_type do_widen(char c) const {
+        return (char_type) (unsigned char) c;
+    }
+    virtual const char * do_widen(const char *low, const char *high,
+            char_type *to) const {
+        for (; low < high; low++) *to++ = (char_type) (unsigned char) *low;
+        return high;
+    }
+    virtual char do_narrow(char_type c, char dfault) const {
+        return (c < 0x80 ? (char) c : dfault);
+    }
+    virtual const char_type * do_narrow(const char_type *low,
+            const char_type *high, char dfault, char *to) const {
+        for (; low < high; low++) *to++ = do_narrow(*low, dfault);
+        return high;
+    }
+
+private:
+    /** Bits of ctype_base::graph that are not part of other types. */
+    static mask graphOnly() { return graph & ~(alpha|digit|punct); }
+
+    /**
+     * Convert MINIUCD_CTYPE_* flags to ctype_base mask.
+     */
+    static mask toMask(int types) {
+        mask m = 0;
+        if (types & MINIUCD_CTYPE_SPACE) m |= space;
+        if (types & MINIUCD_CTYPE_PRINT) m |= print;
+        if (types & MINIUCD_CTYPE_CNTRL) m |= cntrl;
+        if (types & MINIUCD_CTYPE_UPPER) m |= upper;
+        if (types & MINIUCD_CTYPE_LOWER) m |= lower;
+        if (types & MINIUCD_CTYPE_ALPHA) m |= alpha;
+        if (types & MINIUCD_CTYPE_DIGIT) m |= digit;
+        if (types & MINIUCD_CTYPE_PUNCT) m |= punct;
+        if (types & MINIUCD_CTYPE_XDIGIT) m |= xdigit;
+        if (types & MINIUCD_CTYPE_BLANK) m |= blank;
+        if (types & MINIUCD_CTYPE_GRAPH) m |= graphOnly();
+        return m;
+    }
+
+    /**
+     * Convert ctype_base mask to MINIUCD_CTYPE_* flags.
+     */
+    static int fromMask(mask m) {
+        int types = 0;
+        if (m & space) types |= MINIUCD_CTYPE_SPACE;
+        if (m & print) types |= MINIUCD_CTYPE_PRINT;
+        if (m & cntrl) types |= MINIUCD_CTYPE_CNTRL;
+        if (m & upper) types |= MINIUCD_CTYPE_UPPER;
+        if (m & lower) types |= MINIUCD_CTYPE_LOWER;
+        if (m & alpha) types |= MINIUCD_CTYPE_ALPHA;
+        if (m & digit) types |= MINIUCD_CTYPE_DIGIT;
+        if (m & punct) types |= MINIUCD_CTYPE_PUNCT;
+        if (m & xdigit) types |= MINIUCD_CTYPE_XDIGIT;
+        if (m & blank) types |= MINIUCD_CTYPE_BLANK;
+        if (m & graphOnly()) types |= MINIUCD_CTYPE_GRAPH;
+        return types;
+    }
+};
+
+} /* namespace std */
+
+namespace miniucd {
+
+/**
+ * Add the Unicode-aware `std::ctype<char32_t>` facet to a locale, unless
+ * already present.
+ *
+ * @return Locale with facet.
+ */
+inline std::locale
+withCtype(
+    const std::locale &loc) /*!< Locale to add facet to. */
+{
+    return (std::has_facet<std::ctype<char32_t> >(loc)
+        ? loc : std::locale(loc, new std::ctype<char32_t>));
+}
+
+} /* namespace miniucd */
+
+namespace std {
+
+/**
+ * Unicode-aware regular expression traits for `char32_t`.
+ *
+ * Classes are bitsets of character types (POSIX classes, plus `d`, `s` and
+ * `w`), General Category values and Script values. Case-insensitive matching
+ * uses simple case folding. Collation is by codepoint, and primary keys are
+ * case folded.
+ *
+ * The traits locale always includes the `std::ctype<char32_t>` facet.
+ */
+template<>
+class regex_traits<char32_t> {
+public:
+    typedef char32_t char_type;          /*!< Character type. */
+    typedef u32string string_type;       /*!< String type. */
+    typedef locale locale_type;          /*!< Locale type. */
+
+    /** Class bitset. */
+    typedef bitset<miniucd::detail::NBCLASSES> char_class_type;
+
+    /** Constructor. */
+    regex_traits() : loc(miniucd::withCtype(locale())) {}
+
+    /*
+     * Public interface, see std::regex_traits.
+     */
+    static size_t length(const char_type *p) {
+        return char_traits<char_type>::length(p);
+    }
+    char_type translate(char_type c) const { return c; }
+    char_type translate_nocase(char_type c) const {
+        return MiniUCD_GetProperty_Scf(c);
+    }
+    template<typename ForwardIterator>
+    string_type transform(ForwardIterator first,
+            ForwardIterator last) const {
+        return string_type(first, last);
+    }
+    template<typename ForwardIterator>
+    string_type transform_primary(ForwardIterator first,
+            ForwardIterator last) const {
+        string_type s(first, last);
+        for (size_t i = 0; i < s.size(); i++) {
+            s[i] = MiniUCD_GetProperty_Scf(s[i]);
+        }
+        return s;
+    }
+    template<typename ForwardIterator>
+    string_type lookup_collatename(ForwardIterator first,
+            ForwardIterator last) const {
+        string_type s(first, last);
+        return (s.size() == 1 ? s : string_type());
+    }
+    template<typename ForwardIterator>
+    char_class_type lookup_classname(ForwardIterator first,
+            ForwardIterator last, bool icase = false) const;
+    bool isctype(char_type c, char_class_type f) const;
+    int value(char_type ch, int radix) const;
+    locale_type imbue(locale_type l) {
+        locale_type old = loc;
+        loc = miniucd::withCtype(l);
+        return old;
+    }
+    locale_type getloc() const { return loc; }
+
+private:
+    locale_type loc; /*!< Locale. */
+};
+
+/**
+ * Get class from its name: POSIX class names and `d`, `s` and `w`, then
+ * General Category values and groups, then Script values. Names are matched
+ * loosely.
+ *
+ * @return Class, or empty set if unknown.
+ */
+template<typename ForwardIterator>
+regex_traits<char32_t>::char_class_type
+regex_traits<char32_t>::lookup_classname(
+    ForwardIterator first, /*!< Beginning of name. */
+    ForwardIterator last,  /*!< End of name. */
+    bool icase) const      /*!< Case-insensitive matching. */
+{
+    static const struct {
+        const char *name;
+        int types;
+    } posix[] = {
+        {"alnum", MINIUCD_CTYPE_ALNUM}, {"alpha", MINIUCD_CTYPE_ALPHA},
+        {"blank", MINIUCD_CTYPE_BLANK}, {"cntrl", MINIUCD_CTYPE_CNTRL},
+        {"d", MINIUCD_CTYPE_DIGIT}, {"digit", MINIUCD_CTYPE_DIGIT},
+        {"graph", MINIUCD_CTYPE_GRAPH}, {"lower", MINIUCD_CTYPE_LOWER},
+        {"print", MINIUCD_CTYPE_PRINT}, {"punct", MINIUCD_CTYPE_PUNCT},
+        {"s", MINIUCD_CTYPE_SPACE}, {"space", MINIUCD_CTYPE_SPACE},
+        {"upper", MINIUCD_CTYPE_UPPER}, {"w", MINIUCD_CTYPE_WORD},
+        {"xdigit", MINIUCD_CTYPE_XDIGIT},
+    };
+    using namespace miniucd::detail;
+    const int cased = MINIUCD_CTYPE_UPPER|MINIUCD_CTYPE_LOWER;
+    char name[CLASSNAME_MAXLENGTH+1];
+    size_t length = 0, i;
+    int types = 0, value;
+    char_class_type classes;
+
+    for (; first != last; ++first) {
+        if (length == CLASSNAME_MAXLENGTH || *first >= 0x80) return classes;
+        name[length] = (char) *first;
+        if (name[length] >= 'A' && name[length] <= 'Z') {
+            name[length] += 'a'-'A';
+        }
+        length++;
+    }
+    name[length] = 0;
+
+    for (i = 0; i < sizeof(posix)/sizeof(*posix); i++) {
+        if (char_traits<char>::length(posix[i].name) == length
+                && char_traits<char>::compare(name, posix[i].name,
+                    length) == 0) {
+            types = posix[i].types;
+            break;
+        }
+    }
+    if (!types) {
+        value = MiniUCD_LookupPropertyValue(MINIUCD_GC, name, length);
+        if (value > MINIUCD_GC_NBVALUES) {
+            for (i = 1; i <= MINIUCD_GC_NBVALUES; i++) {
+                if (gcGroups[value-MINIUCD_GC_NBVALUES-1] & (1UL << i)) {
+                    classes.set(CLASS_GC+i);
+                }
+            }
+        } else if (value > 0) {
+            classes.set(CLASS_GC+value);
+        } else if ((value = MiniUCD_LookupPropertyValue(MINIUCD_SC, name,
+                length)) > 0) {
+            classes.set(CLASS_SC+value);
+        }
+    }
+
+    if (icase && ((types & cased) || classes[CLASS_GC+MINIUCD_GC_LU]
+            || classes[CLASS_GC+MINIUCD_GC_LL]
+            || classes[CLASS_GC+MINIUCD_GC_LT])) {
+        /* Cased letters regardless of case. */
+        types |= cased;
+        classes.set(CLASS_GC+MINIUCD_GC_LU);
+        classes.set(CLASS_GC+MINIUCD_GC_LL);
+        classes.set(CLASS_GC+MINIUCD_GC_LT);
+    }
+    for (i = 0; i < MINIUCD_CTYPE_NBFLAGS; i++) {
+        if (types & (1 << i)) classes.set(CLASS_CTYPE+i);
+    }
+    return classes;
+}
+
+/**
+ * Tell whether codepoint belongs to class.
+ *
+ * @return Whether codepoint belongs to class.
+ */
+inline bool
+regex_traits<char32_t>::isctype(
+    char_type c,             /*!< Codepoint. */
+    char_class_type f) const /*!< Class. */
+{
+    using namespace miniucd::detail;
+    int types = MiniUCD_GetCtype(c);
+    size_t i;
+    for (i = 0; i < MINIUCD_CTYPE_NBFLAGS; i++) {
+        if ((types & (1 << i)) && f[CLASS_CTYPE+i]) return true;
+    }
+    return (f[CLASS_GC+MiniUCD_GetProperty_Gc(c)]
+        || f[CLASS_SC+MiniUCD_GetProperty_Sc(c)]);
+}
+
+/**
+ * Get the value of a digit in the given radix. Decimal digits of all scripts
+ * are accepted, as well as ASCII letters for radix 16.
+ *
+ * @return Digit value, or -1 if not a digit.
+ */
+inline int
+regex_traits<char32_t>::value(
+    char_type ch,    /*!< Codepoint. */
+    int radix) const /*!< Radix (8, 10 or 16). */
+{
+    int digit;
+    if (radix == 16 && ch >= 'a' && ch <= 'f') return (int) (ch-'a'+10);
+    if (radix == 16 && ch >= 'A' && ch <= 'F') return (int) (ch-'A'+10);
+    digit = MiniUCD_GetDigitValue(ch);
+    return (digit < radix ? digit : -1);
+}
+
+} /* namespace std */
+
+/* End of C++ Support *//*!\}*/
+
+#endif /* _MINIUCD_HPP */
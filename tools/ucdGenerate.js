@@ -14,6 +14,21 @@ import { version, ucdroot, datafile, outputdir } from "./config.js";
 
 import { properties } from "./ucdPropertyTypes.js";
 import { classes, classes_nocase, symbols } from "./ucdRegex.js";
+import {
+  flags,
+  compileGraphemeBreak,
+  compileWordBreak,
+  compileSentenceBreak,
+  compileSyllableBreak,
+  compileEmojiSequences,
+  emojiTypes,
+  emojiFlags,
+  compileJoining,
+  joiningForms,
+  joiningFlags,
+  compileLineBreak,
+} from "./ucdSegmentation.js";
+import { compileUtf8Automaton } from "./ucdUtf8.js";
 
 // Check if required files exist
 if (!existsSync(datafile)) {
@@ -139,6 +154,656 @@ function processRangeValues(values, type) {
   return [indices, uniqueValues];
 }
 
+/**
+ * Merge ranges of values of several properties into a single range table, so
+ * that one lookup gives the combined value.
+ *
+ * @param propertyValues  Per-property ranges of values.
+ * @param names           Names of properties to merge.
+ * @param valueOf         Function computing the merged value from the
+ *                        property values (in the same order as names),
+ *                        followed by the codepoint.
+ * @param singletons      Codepoints that get their own range.
+ *
+ * @return Ranges of merged values, in the same format as propertyValues.
+ */
+function fuseProperties(propertyValues, names, valueOf, singletons = []) {
+  const cps = new Set();
+  for (const cp of singletons) {
+    cps.add(cp);
+    cps.add(cp + 1);
+  }
+  for (const name of names) {
+    for (const cpHex of Object.keys(propertyValues[name])) {
+      cps.add(parseInt(cpHex, 16));
+    }
+  }
+  const current = {};
+  const rangeValues = {};
+  let last;
+  for (const cp of [...cps].sort((a, b) => a - b)) {
+    const cpHex = toHex(cp);
+    for (const name of names) {
+      if (cpHex in propertyValues[name]) {
+        current[name] = propertyValues[name][cpHex];
+      }
+    }
+    const value = valueOf(...names.map((name) => current[name]), cp);
+    if (value !== last) {
+      rangeValues[cpHex] = value;
+      last = value;
+    }
+  }
+  return rangeValues;
+}
+
+/**
+ * Get flat array of values for ASCII characters from ranges of values.
+ *
+ * @param rangeValues Ranges of values, in the same format as propertyValues.
+ *
+ * @return Array of 128 values.
+ */
+function asciiValues(rangeValues) {
+  const cps = Object.keys(rangeValues);
+  const ascii = [];
+  for (let c = 0, i = 0; c < 0x80; c++) {
+    while (i + 1 < cps.length && parseInt(cps[i + 1], 16) <= c) i++;
+    ascii.push(rangeValues[cps[i]]);
+  }
+  return ascii;
+}
+
+/**
+ * Build a class table from merged ranges of values.
+ *
+ * @param name        Table name.
+ * @param rangeValues Ranges of class names, as returned by fuseProperties.
+ *
+ * @return Class table descriptor for the template.
+ */
+function buildClassTable(name, rangeValues) {
+  const classNames = [...new Set(Object.values(rangeValues))].sort();
+  return { name, classNames, rangeValues, ascii: asciiValues(rangeValues) };
+}
+
+/**
+ * Compute grapheme break class from property values of a codepoint.
+ *
+ * @return Class name, e.g. "EX_Linker".
+ */
+function graphemeBreakClass(GCB, ExtPict, InCB) {
+  let cls = GCB;
+  if (ExtPict === "Y") cls += "_ExtPict";
+  if (InCB !== "None") cls += `_${InCB}`;
+  return cls;
+}
+
+/**
+ * Parse grapheme break class name.
+ *
+ * @return Class as { gcb, extPict, incb } object.
+ *
+ * @see graphemeBreakClass
+ */
+function parseGraphemeBreakClass(cls) {
+  const [gcb, ...suffixes] = cls.split("_");
+  return {
+    gcb,
+    extPict: suffixes.includes("ExtPict"),
+    incb: suffixes.find((suffix) => suffix !== "ExtPict"),
+  };
+}
+
+/** Syllable categories of Indic_Syllabic_Category values. */
+const SYLLABLE_CATEGORIES = {
+  Consonant: "C",
+  Consonant_Dead: "C",
+  Consonant_With_Stacker: "C",
+  Consonant_Prefixed: "C",
+  Consonant_Head_Letter: "C",
+  Consonant_Initial_Postfixed: "C",
+  Brahmi_Joining_Number: "C",
+  Consonant_Placeholder: "P",
+  Vowel_Independent: "V",
+  Avagraha: "V",
+  Modifying_Letter: "V",
+  Consonant_Preceding_Repha: "R",
+  Nukta: "N",
+  Virama: "H",
+  Invisible_Stacker: "HL",
+  Number_Joiner: "HL",
+  Joiner: "ZWJ",
+  Non_Joiner: "ZWNJ",
+  Other: "Other",
+  Number: "Other",
+};
+
+/** Codepoints with their own emoji class. */
+const EMOJI_SINGLETONS = {
+  0x200d: "ZWJ",
+  0x20e3: "Keycap",
+  0xfe0e: "VS15",
+  0xfe0f: "VS16",
+  0xe007f: "TagEnd",
+};
+
+/**
+ * Compute emoji class from emoji properties of a codepoint.
+ *
+ * Extended_Pictographic codepoints that are not yet emoji are classified as
+ * text presentation emoji, so that sequences using them are recognized once
+ * they get assigned.
+ *
+ * @return Emoji class.
+ *
+ * @see compileEmojiSequences
+ */
+function emojiClass(Emoji, EPres, EMod, EBase, EComp, ExtPict, RI, cp) {
+  if (cp in EMOJI_SINGLETONS) return EMOJI_SINGLETONS[cp];
+  if (RI === "Y") return "RI";
+  if (EMod === "Y") return "Mod";
+  if (EComp === "Y" && cp >= 0xe0020 && cp <= 0xe007e) return "Tag";
+  if (EComp === "Y" && Emoji === "Y" && cp < 0x80) return "KeycapBase";
+  if (Emoji !== "Y" && ExtPict !== "Y") return "Other";
+  const base = EBase === "Y" ? "Base" : "";
+  return (EPres === "Y" ? "Pres" : "Text") + base;
+}
+
+/**
+ * Compute joining class from property values of a codepoint.
+ *
+ * Join_Causing characters (e.g. ZWJ or tatweel) join on both sides like
+ * dual-joining letters. Syriac Alaph, Dalath and Rish get their own classes
+ * as they select special final forms.
+ *
+ * @return Joining class.
+ *
+ * @see compileJoining
+ */
+function joiningClass(jt, jg) {
+  if (jg === "Alaph" || jg === "Dalath_Rish") return jg;
+  if (jt === "C") return "D";
+  return jt;
+}
+
+/**
+ * Test whether a codepoint is a joiner or variation selector, i.e. a default
+ * ignorable character that is meaningful within sequences.
+ */
+const isJoiner = (cp) =>
+  (cp >= 0x180b && cp <= 0x180d) ||
+  cp === 0x180f ||
+  cp === 0x200c ||
+  cp === 0x200d ||
+  (cp >= 0xfe00 && cp <= 0xfe0f) ||
+  (cp >= 0xe0100 && cp <= 0xe01ef);
+
+/** Boundaries of joiner ranges within default ignorable ranges. */
+const JOINER_SINGLETONS = [0x180e, 0x200c, 0x200d, 0xe0100, 0xe01ef];
+
+/**
+ * Compute text filtering class from property values of a codepoint.
+ *
+ * Classes combine White_Space, Pattern_White_Space,
+ * Default_Ignorable_Code_Point, joiners and variation selectors, and control
+ * characters (gc=Cc) that are not white space.
+ *
+ * @return Text filtering class.
+ */
+function textFilterClass(WSpace, Pat_WS, DI, gc, cp) {
+  const flags = [];
+  if (WSpace === "Y") flags.push("WSpace");
+  if (Pat_WS === "Y") flags.push("PatWS");
+  if (DI === "Y") flags.push(isJoiner(cp) ? "Joiner" : "DI");
+  if (gc === "Cc" && WSpace !== "Y") flags.push("Control");
+  return flags.join("_") || "Other";
+}
+
+/** Hexadecimal digits and tab, which get their own character type. */
+const CTYPE_SINGLETONS = [
+  0x09,
+  ...[..."0123456789ABCDEFabcdef"].map((c) => c.charCodeAt(0)),
+];
+
+/**
+ * Compute character type class from property values of a codepoint.
+ *
+ * Classes combine the POSIX-like character types of the regex classes from
+ * ucdRegex.js, each flag giving a MINIUCD_CTYPE_* constant.
+ *
+ * @return Character type class.
+ */
+function ctypeClass(gc, WSpace, cp) {
+  const flags = [];
+  if (WSpace === "Y") flags.push("Space");
+  if (!gc.startsWith("C")) flags.push("Print");
+  if (gc === "Cc") flags.push("Cntrl");
+  if (gc === "Lu") flags.push("Upper");
+  if (gc === "Ll") flags.push("Lower");
+  if (gc.startsWith("L")) flags.push("Alpha");
+  if (gc === "Nd") flags.push("Digit");
+  if (gc.startsWith("P") || gc.startsWith("S")) flags.push("Punct");
+  if (cp < 0x80 && /[0-9A-Fa-f]/.test(String.fromCharCode(cp))) {
+    flags.push("Xdigit");
+  }
+  if (gc === "Zs" || cp === 0x09) flags.push("Blank");
+  if (!gc.startsWith("Z") && !gc.startsWith("C")) flags.push("Graph");
+  if (gc.startsWith("L") || gc.startsWith("N") || gc === "Pc") {
+    flags.push("Word");
+  }
+  return flags.join("_") || "Other";
+}
+
+/** Changes-when properties, in the order of MINIUCD_CW_* flags. */
+const CHANGES_WHEN = {
+  CWL: "LOWERCASED",
+  CWU: "UPPERCASED",
+  CWT: "TITLECASED",
+  CWCF: "CASEFOLDED",
+  CWCM: "CASEMAPPED",
+  CWKCF: "NFKC_CASEFOLDED",
+};
+
+/**
+ * Compute changes-when class from property values of a codepoint.
+ *
+ * Classes combine the names of the Changes_When_* properties that hold, each
+ * giving a MINIUCD_CW_* flag.
+ *
+ * @return Changes-when class, e.g. "CWL_CWCF_CWCM_CWKCF".
+ */
+function changesWhenClass(...args) {
+  const flags = Object.keys(CHANGES_WHEN).filter(
+    (property, i) => args[i] === "Y"
+  );
+  return flags.join("_") || "Other";
+}
+
+/**
+ * Get ASCII byte bounds of changes-when properties, for word-at-a-time
+ * scanning.
+ *
+ * Each property gets two byte ranges; when ASCII members span more than two
+ * runs, the last runs are merged into the second range, which stays a
+ * superset.
+ *
+ * @return Array of [first1, last1, first2, last2] bounds, empty ranges being
+ *         [1, 0].
+ */
+function changesWhenAsciiBounds(changesWhenClasses) {
+  return Object.keys(CHANGES_WHEN).map((property) => {
+    const runs = [];
+    changesWhenClasses.ascii.forEach((cls, c) => {
+      if (!cls.split("_").includes(property)) return;
+      const run = runs[runs.length - 1];
+      if (run && run[1] === c - 1) {
+        run[1] = c;
+      } else {
+        runs.push([c, c]);
+      }
+    });
+    if (runs.length > 2) {
+      runs.splice(1, runs.length, [runs[1][0], runs[runs.length - 1][1]]);
+    }
+    while (runs.length < 2) runs.push([1, 0]);
+    return runs.flat();
+  });
+}
+
+/**
+ * Compute syllable category from property values of a codepoint.
+ *
+ * Viramas link consonants into conjuncts when they are InCB=Linker (as in
+ * GB9c); dependent vowels written before their consonant in logical order
+ * (InPC=Visual_Order_Left) attach to the following consonant; other Indic
+ * characters not listed in SYLLABLE_CATEGORIES are marks attaching to their
+ * base.
+ *
+ * @return Syllable category.
+ *
+ * @see compileSyllableBreak
+ */
+function syllableClass(InSC, InCB, GCB, InPC) {
+  const cls = SYLLABLE_CATEGORIES[InSC] || "M";
+  if (cls === "H" && InCB === "Linker") return "HL";
+  if (InSC === "Vowel_Dependent" && InPC === "Visual_Order_Left") return "VL";
+  if (cls === "Other") {
+    if (GCB === "EX" || GCB === "SM") return "EX";
+    if (GCB === "CR" || GCB === "LF") return GCB;
+  }
+  return cls;
+}
+
+/**
+ * Compute identifier class from property values of a codepoint.
+ *
+ * @return Class name: "Start", "Continue" or "Other", with a "_NotNFKC"
+ *         suffix for codepoints that can't occur in NFKC-normalized text.
+ */
+function identifierClass(XIDS, XIDC, NFKC_QC) {
+  const cls = XIDS === "Y" ? "Start" : XIDC === "Y" ? "Continue" : "Other";
+  return NFKC_QC === "N" ? `${cls}_NotNFKC` : cls;
+}
+
+/** Recommended scripts (UAX #31 table 5). */
+const RECOMMENDED_SCRIPTS = [
+  "Zyyy", "Zinh", "Arab", "Armn", "Beng", "Bopo", "Cyrl", "Deva", "Ethi",
+  "Geor", "Grek", "Gujr", "Guru", "Hang", "Hani", "Hebr", "Hira", "Kana",
+  "Khmr", "Knda", "Laoo", "Latn", "Mlym", "Mymr", "Orya", "Sinh", "Taml",
+  "Telu", "Thaa", "Thai", "Tibt",
+];
+
+/** Script sets covering Highly Restrictive strings (UTS #39 section 5.2). */
+const HIGHLY_RESTRICTIVE_SCRIPTS = [
+  ["Latn", "Hani", "Hira", "Kana"],
+  ["Latn", "Hani", "Bopo"],
+  ["Latn", "Hani", "Hang"],
+];
+
+/** Scripts excluded from Moderately Restrictive mixes with Latin. */
+const MODERATELY_RESTRICTIVE_EXCLUDED = ["Latn", "Cyrl", "Grek"];
+
+/**
+ * Build script set tables.
+ *
+ * Script sets are bitsets of 32-bit words indexed by Script values. Sets of
+ * codepoints are augmented as in UTS #39 section 5.1: Han, Hiragana,
+ * Katakana, Hangul and Bopomofo get the pseudo-scripts Hanb, Jpan and Kore
+ * (numbered after the last Script value), and Common and Inherited get all
+ * scripts.
+ *
+ * @param scripts     Script value aliases.
+ * @param rangeValues Ranges of Script_Extensions values.
+ *
+ * @return { indices, sets, named }: set index for each range, unique sets as
+ *         arrays of words, and named sets used by the restriction level
+ *         algorithm.
+ */
+function buildScriptSets(scripts, rangeValues) {
+  const nbScripts = scripts.length + 3;
+  const code = (name) => {
+    const pseudo = ["Hanb", "Jpan", "Kore"].indexOf(name);
+    if (pseudo >= 0) return scripts.length + 1 + pseudo;
+    const index = scripts.findIndex((aliases) => aliases.includes(name));
+    if (index < 0) throw new Error(`Unknown script ${name}`);
+    return index + 1;
+  };
+  const augmented = {
+    Hani: ["Hanb", "Jpan", "Kore"],
+    Hira: ["Jpan"],
+    Kana: ["Jpan"],
+    Hang: ["Kore"],
+    Bopo: ["Hanb"],
+  };
+  const toWords = (codes) => {
+    const words = new Array((nbScripts >> 5) + 1).fill(0);
+    for (const c of codes) {
+      words[c >> 5] = (words[c >> 5] | (1 << (c & 31))) >>> 0;
+    }
+    return words;
+  };
+  const all = [...Array(nbScripts).keys()].map((c) => c + 1);
+  const setOf = (names) => {
+    if (names.length === 1 && (names[0] === "Zyyy" || names[0] === "Zinh")) {
+      return toWords(all);
+    }
+    return toWords(
+      names
+        .flatMap((name) => [name, ...(augmented[name] || [])])
+        .map(code)
+    );
+  };
+
+  const sets = [];
+  const setIndices = new Map();
+  const indices = Object.values(rangeValues).map((value) => {
+    const words = setOf(Array.isArray(value) ? value : [value]);
+    const key = words.join(",");
+    if (!setIndices.has(key)) {
+      setIndices.set(key, sets.length);
+      sets.push(words);
+    }
+    return setIndices.get(key);
+  });
+  const named = {
+    all: {
+      description: "All scripts.",
+      words: toWords(all),
+    },
+    latin: {
+      description: "Latin script.",
+      words: toWords([code("Latn")]),
+    },
+    recommended: {
+      description: "Recommended scripts (UAX #31).",
+      words: toWords(RECOMMENDED_SCRIPTS.map(code)),
+    },
+    moderatelyRestrictive: {
+      description:
+        "Recommended scripts that can be mixed with Latin in Moderately " +
+        "Restrictive strings.",
+      words: toWords(
+        RECOMMENDED_SCRIPTS.filter(
+          (name) =>
+            !MODERATELY_RESTRICTIVE_EXCLUDED.includes(name) &&
+            name !== "Zyyy" &&
+            name !== "Zinh"
+        ).map(code)
+      ),
+    },
+  };
+  HIGHLY_RESTRICTIVE_SCRIPTS.forEach((names, i) => {
+    named[`highlyRestrictive${i + 1}`] = {
+      description: `Scripts covering Highly Restrictive strings: ${names.join(
+        " + "
+      )}.`,
+      words: toWords(names.map(code)),
+    };
+  });
+  return { indices, sets, named };
+}
+
+/**
+ * Parse numeric value atom into rational.
+ *
+ * @param atom  Numeric value string, e.g. "1/2", "-1/2", "1000" or "NaN".
+ *
+ * @return { numerator, denominator, value } strings for C literals; NaN
+ *         gives a zero denominator.
+ */
+function parseRational(atom) {
+  if (atom === "NaN") return { numerator: "0", denominator: "0", value: "0.0" };
+  const [numerator, denominator = "1"] = atom.split("/");
+  return {
+    numerator,
+    denominator,
+    value:
+      denominator === "1" ? `${numerator}.0` : `${numerator}.0/${denominator}`,
+  };
+}
+
+/**
+ * Get first codepoints of decimal digit sets.
+ *
+ * Characters with Numeric_Type=Decimal come in contiguous runs of 10, from 0
+ * to 9; this is checked here so that the runtime can rely on it.
+ *
+ * @param nt  Ranges of Numeric_Type values.
+ * @param nv  Ranges of Numeric_Value values.
+ *
+ * @return Sorted codepoints of zero digits.
+ */
+function digitZeros(nt, nv) {
+  const starts = (rangeValues) =>
+    Object.keys(rangeValues).map((cp) => parseInt(cp, 16));
+  const valueAt = (rangeValues, keys) => (cp) => {
+    let i = keys.findIndex((start) => start > cp);
+    i = (i < 0 ? keys.length : i) - 1;
+    return rangeValues[toHex(keys[i])];
+  };
+  const ntAt = valueAt(nt, starts(nt));
+  const nvAt = valueAt(nv, starts(nv));
+  const zeros = [];
+  const ntKeys = starts(nt);
+  ntKeys.forEach((start, i) => {
+    if (nt[toHex(start)] !== "De") return;
+    const end = i + 1 < ntKeys.length ? ntKeys[i + 1] : start;
+    for (let cp = start; cp < end; cp++) {
+      if (nvAt(cp) !== String((cp - start) % 10) || ntAt(cp) !== "De") {
+        throw new Error(`Unexpected decimal digit ${toHex(cp)}`);
+      }
+      if ((cp - start) % 10 === 0) zeros.push(cp);
+    }
+    if ((end - start) % 10 !== 0) {
+      throw new Error(`Incomplete decimal digit set at ${toHex(start)}`);
+    }
+  });
+  return zeros;
+}
+
+/**
+ * Check that Canonical_Combining_Class values are listed in numeric order.
+ *
+ * Enum constants are numbered in this order, so that comparing them is the
+ * same as comparing the numeric classes during canonical ordering.
+ *
+ * @param values  Property value aliases, numeric value first.
+ */
+function checkCanonicalCombiningClasses(values) {
+  values.forEach(([value], i) => {
+    if (i > 0 && Number(value) <= Number(values[i - 1][0])) {
+      throw new Error(`Unordered canonical combining class ${value}`);
+    }
+  });
+}
+
+/** Display width values. */
+const WIDTH_ZERO = 0;
+const WIDTH_NARROW = 1;
+const WIDTH_WIDE = 2;
+const WIDTH_AMBIGUOUS = 3;
+
+/** U+00AD SOFT HYPHEN, displayed as a hyphen by terminals. */
+const SOFT_HYPHEN = 0xad;
+
+/** General categories of zero width codepoints. */
+const ZERO_WIDTH_GC = ["Cc", "Mn", "Me", "Cf", "Zl", "Zp"];
+
+/**
+ * Compute display width of a codepoint from its property values.
+ *
+ * Follows UAX #11 for East Asian widths and common terminal practice for the
+ * rest: controls, nonspacing and enclosing marks, format characters (except
+ * SOFT HYPHEN), default ignorables, and conjoining Hangul vowels and trailing
+ * consonants take no space.
+ *
+ * @return Width value.
+ */
+function displayWidth(ea, gc, DI, hst, cp) {
+  if (
+    cp !== SOFT_HYPHEN &&
+    hst !== "L" &&
+    (ZERO_WIDTH_GC.includes(gc) || DI === "Y" || hst === "V" || hst === "T")
+  ) {
+    return WIDTH_ZERO;
+  }
+  if (ea === "W" || ea === "F") return WIDTH_WIDE;
+  if (ea === "A") return WIDTH_AMBIGUOUS;
+  return WIDTH_NARROW;
+}
+
+/**
+ * Build two-level display width table.
+ *
+ * Codepoints are split into blocks of 256; each block is stored as 2-bit
+ * width values packed 4 per byte, and identical blocks are shared.
+ *
+ * @param rangeValues Ranges of width values, as returned by fuseProperties.
+ * @param lastCp      Last codepoint.
+ *
+ * @return { index, blocks }: block index for each 256-codepoint block, and
+ *         unique blocks as arrays of 64 bytes.
+ */
+function buildWidthTable(rangeValues, lastCp) {
+  const widths = new Uint8Array(lastCp + 1);
+  const starts = Object.keys(rangeValues).map((cp) => parseInt(cp, 16));
+  starts.forEach((start, i) => {
+    const end = i + 1 < starts.length ? starts[i + 1] : lastCp + 1;
+    widths.fill(rangeValues[toHex(start)], start, end);
+  });
+  const index = [];
+  const blocks = [];
+  const blockIndices = new Map();
+  for (let block = 0; block <= lastCp >> 8; block++) {
+    const bytes = [];
+    for (let cp = block << 8; cp < (block + 1) << 8; cp += 4) {
+      bytes.push(
+        widths[cp] |
+          (widths[cp + 1] << 2) |
+          (widths[cp + 2] << 4) |
+          (widths[cp + 3] << 6)
+      );
+    }
+    const key = bytes.join(",");
+    if (!blockIndices.has(key)) {
+      blockIndices.set(key, blocks.length);
+      blocks.push(bytes);
+    }
+    index.push(blockIndices.get(key));
+  }
+  return { index, blocks };
+}
+
+/** U+25CC DOTTED CIRCLE, an aksara base for LB28a. */
+const DOTTED_CIRCLE = 0x25cc;
+
+/** U+2010 HYPHEN, a word-initial hyphen for LB20a. */
+const HYPHEN = 0x2010;
+
+/** East_Asian_Width values of $EastAsian in UAX #14. */
+const EAST_ASIAN = ["F", "W", "H"];
+
+/**
+ * Compute line break class from property values of a codepoint.
+ *
+ * LB1 is applied here, except for AI and CJ whose resolution depends on
+ * runtime options. Suffixes record the extra information needed by the rules.
+ *
+ * @return Class name, e.g. "QU_Pi_EA".
+ */
+function lineBreakClass(lb, ea, gc, ExtPict, cp) {
+  if (lb === "SA") lb = gc === "Mn" || gc === "Mc" ? "CM" : "AL";
+  if (lb === "SG" || lb === "XX") lb = "AL";
+  let cls = lb;
+  if (lb === "QU" && (gc === "Pi" || gc === "Pf")) cls += `_${gc}`;
+  if (cp === DOTTED_CIRCLE) cls += "_DottedCircle";
+  if (cp === HYPHEN) cls += "_Hyphen";
+  if (ExtPict === "Y" && gc === "Cn") cls += "_ExtPictCn";
+  if (EAST_ASIAN.includes(ea)) cls += "_EA";
+  return cls;
+}
+
+/**
+ * Parse line break class name.
+ *
+ * @return Class as { lb, ea, pi, pf, dc, hh, epcn } object.
+ *
+ * @see lineBreakClass
+ */
+function parseLineBreakClass(cls) {
+  const [lb, ...suffixes] = cls.split("_");
+  return {
+    lb,
+    ea: suffixes.includes("EA"),
+    pi: suffixes.includes("Pi"),
+    pf: suffixes.includes("Pf"),
+    dc: suffixes.includes("DottedCircle"),
+    hh: suffixes.includes("Hyphen"),
+    epcn: suffixes.includes("ExtPictCn"),
+  };
+}
+
 /**
  * Generate charValues and rangeValues for regc_ucd.inc
  */
@@ -192,6 +857,342 @@ function processClassCriteria(criteria, propertyValues) {
   return { charValues, rangeValues };
 }
 
+/** Highest Unicode codepoint. */
+const MAX_CODEPOINT = 0x10ffff;
+
+/**
+ * Get membership array of a regc_ucd.inc class.
+ *
+ * @return Array with nonzero entries for member codepoints.
+ */
+function classMembers({ charValues, rangeValues }) {
+  const members = new Uint8Array(MAX_CODEPOINT + 1);
+  const toCp = (v) => (v === "COL_CHAR_MAX" ? MAX_CODEPOINT : parseInt(v));
+  for (const v of charValues) members[toCp(v)] = 1;
+  for (let i = 0; i < rangeValues.length; i += 2) {
+    members.fill(1, toCp(rangeValues[i]), toCp(rangeValues[i + 1]) + 1);
+  }
+  return members;
+}
+
+/**
+ * Compute case orbits, i.e. sets of codepoints related by simple case
+ * mappings (scf, slc, suc & stc).
+ *
+ * @return Map of codepoints with case variants to the next codepoint in their
+ *         orbit, in ascending order and wrapping around.
+ */
+function computeCaseOrbits(propertyValues) {
+  const parent = new Map();
+  const find = (c) => {
+    while (parent.has(c) && parent.get(c) !== c) c = parent.get(c);
+    return c;
+  };
+  for (const property of ["scf", "slc", "suc", "stc"]) {
+    const ranges = Object.entries(propertyValues[property]);
+    ranges.forEach(([cpHex, offset], index) => {
+      if (!offset) return;
+      const start = parseInt(cpHex, 16);
+      const end =
+        index + 1 < ranges.length
+          ? parseInt(ranges[index + 1][0], 16)
+          : MAX_CODEPOINT + 1;
+      for (let c = start; c < end; c++) {
+        const a = find(c);
+        const b = find(c + offset);
+        if (a === b) continue;
+        parent.set(a, Math.min(a, b));
+        parent.set(b, Math.min(a, b));
+      }
+    });
+  }
+
+  const orbits = new Map();
+  for (const c of parent.keys()) {
+    const root = find(c);
+    if (!orbits.has(root)) orbits.set(root, []);
+    orbits.get(root).push(c);
+  }
+  const next = new Map();
+  for (const orbit of orbits.values()) {
+    orbit.sort((a, b) => a - b);
+    orbit.forEach((c, i) => next.set(c, orbit[(i + 1) % orbit.length]));
+  }
+  return next;
+}
+
+/**
+ * Build case orbit table, i.e. ranges of codepoints sharing the same offset to
+ * the next codepoint in their orbit, zero for codepoints without case
+ * variants.
+ *
+ * Offsets of alternating upper/lowercase pairs are stored as 1 when the even
+ * codepoint comes first, or -1 when the odd one comes first, so that runs of
+ * such pairs fit in a single range.
+ *
+ * @return Table as { ranges, values, nbVariants }.
+ */
+function buildCaseOrbitTable(caseOrbits) {
+  const ranges = [];
+  const values = [];
+  for (let c = 0; c <= MAX_CODEPOINT; c++) {
+    let offset = caseOrbits.has(c) ? caseOrbits.get(c) - c : 0;
+    if (offset === 1 || offset === -1) {
+      offset = (offset === 1) === (c % 2 === 0) ? 1 : -1;
+    }
+    if (values.length > 0 && values[values.length - 1] === offset) continue;
+    if (c > 0) ranges.push(toHex(c));
+    values.push(offset);
+  }
+  return { ranges, values, nbVariants: caseOrbits.size };
+}
+
+/**
+ * Compute charValues and rangeValues of regc_ucd.inc classes, along with
+ * their case-insensitive variants.
+ *
+ * Case-insensitive variants are the case closure of the classes given by
+ * classes_nocase, or the classes themselves. When the closure adds
+ * codepoints, it is stored as a new class suffixed by "_nocase".
+ *
+ * @return Classes as { values: { [className]: { charValues, rangeValues } },
+ *         nocase: { [className]: className } }.
+ */
+function buildRegexClasses(classes, classes_nocase, propertyValues, caseOrbits) {
+  const values = {};
+  for (const [className, criteria] of Object.entries(classes)) {
+    values[className] = processClassCriteria(criteria, propertyValues);
+  }
+
+  const nocase = {};
+  for (const className in classes) {
+    const base = classes_nocase[className] || className;
+    const members = classMembers(values[base]);
+    const closure = members.slice();
+    for (const [c, variant] of caseOrbits) {
+      if (!members[c]) continue;
+      for (let v = variant; v !== c; v = caseOrbits.get(v)) closure[v] = 1;
+    }
+    if (closure.every((member, c) => member === members[c])) {
+      nocase[className] = base;
+      continue;
+    }
+
+    // Convert closure back to charValues and rangeValues.
+    const charValues = [];
+    const rangeValues = [];
+    for (let c = 0; c <= MAX_CODEPOINT; c++) {
+      if (!closure[c]) continue;
+      let last = c;
+      while (last < MAX_CODEPOINT && closure[last + 1]) last++;
+      if (last === c) {
+        charValues.push(toHex(c));
+      } else {
+        rangeValues.push(
+          toHex(c),
+          last === MAX_CODEPOINT ? "COL_CHAR_MAX" : toHex(last)
+        );
+      }
+      c = last;
+    }
+    nocase[className] = `${base}_nocase`;
+    values[`${base}_nocase`] = { charValues, rangeValues };
+  }
+
+  return { values, nocase };
+}
+
+/** Number of codepoints per leaf block of regc_ucd.inc class tries. */
+const TRIE_BLOCK_SIZE = 256;
+
+/**
+ * Build two-level bitmap tries for regc_ucd.inc classes.
+ *
+ * Each class gets an index of leaf blocks (one per 256 codepoints) and a
+ * default value for codepoints past the index. When the codespace ends with
+ * empty or full blocks, the index is trimmed after the last other block;
+ * otherwise it is kept whole. Leaf blocks are 32-byte bitmaps shared by all classes.
+ *
+ * @return Tries as { blocks, tries: { [className]: { index, tail } } }.
+ */
+function buildClassTries(classValues) {
+  const nbBlocks = (MAX_CODEPOINT + 1) / TRIE_BLOCK_SIZE;
+  const blocks = [];
+  const blockIds = new Map();
+  const blockId = (bitmap) => {
+    const key = bitmap.join(",");
+    if (!blockIds.has(key)) {
+      blockIds.set(key, blockIds.size);
+      blocks.push(bitmap);
+    }
+    return blockIds.get(key);
+  };
+
+  // Make sure empty & full blocks come first.
+  blockId(new Array(TRIE_BLOCK_SIZE / 8).fill(0));
+  blockId(new Array(TRIE_BLOCK_SIZE / 8).fill(0xff));
+
+  const tries = {};
+  for (const [className, values] of Object.entries(classValues)) {
+    const members = classMembers(values);
+    const index = [];
+    for (let b = 0; b < nbBlocks; b++) {
+      const bitmap = new Array(TRIE_BLOCK_SIZE / 8).fill(0);
+      for (let i = 0; i < TRIE_BLOCK_SIZE; i++) {
+        if (members[b * TRIE_BLOCK_SIZE + i]) bitmap[i >> 3] |= 1 << (i & 7);
+      }
+      index.push(blockId(bitmap));
+    }
+    // Only trim trailing empty or full blocks, as the tail is a single bit.
+    const tail = index[nbBlocks - 1];
+    if (tail === 0 || tail === 1) {
+      while (index.length > 1 && index[index.length - 1] === tail) index.pop();
+    }
+    tries[className] = { index, tail: tail === 1 ? 1 : 0 };
+  }
+
+  return { blocks, tries };
+}
+
+/**
+ * Hash name with seeded FNV-1a. Must match miniucdHashName.
+ *
+ * @param seed Hash seed, zero for bucket selection.
+ * @param name Name to hash.
+ */
+function nameHash(seed, name) {
+  let hash = Math.imul(0x811c9dc5 ^ seed, 0x01000193) >>> 0;
+  for (const c of name) {
+    hash = Math.imul(hash ^ c.charCodeAt(0), 0x01000193) >>> 0;
+  }
+  return hash;
+}
+
+/**
+ * Build minimal perfect hash of regc_ucd.inc symbol or class names, using
+ * hash and displace: names are first distributed into buckets, then buckets
+ * are placed from the largest down by finding a seed that sends all their
+ * names to free slots.
+ *
+ * @return Hash as { seeds, slots }, where seeds are indexed by bucket and
+ *         slots give the index of names.
+ */
+function buildPerfectHash(names) {
+  let nbBuckets = 1;
+  while (nbBuckets * 2 < names.length) nbBuckets *= 2;
+  const buckets = Array.from({ length: nbBuckets }, () => []);
+  names.forEach((name, index) =>
+    buckets[nameHash(0, name) & (nbBuckets - 1)].push(index)
+  );
+
+  const seeds = new Array(nbBuckets).fill(0);
+  const slots = new Array(names.length).fill(-1);
+  const order = [...buckets.keys()].sort(
+    (a, b) => buckets[b].length - buckets[a].length || a - b
+  );
+  for (const bucket of order) {
+    if (buckets[bucket].length === 0) continue;
+    for (let seed = 1; ; seed++) {
+      if (seed > 0xffff) throw new Error("Cannot build perfect hash");
+      const candidates = buckets[bucket].map(
+        (index) => nameHash(seed, names[index]) % names.length
+      );
+      if (
+        new Set(candidates).size === candidates.length &&
+        candidates.every((slot) => slots[slot] === -1)
+      ) {
+        candidates.forEach((slot, i) => (slots[slot] = buckets[bucket][i]));
+        seeds[bucket] = seed;
+        break;
+      }
+    }
+  }
+
+  return { seeds, slots };
+}
+
+/**
+ * Normalize name for loose matching (UAX #44 LM3): ignore case, spaces,
+ * underscores and hyphens.
+ */
+const looseName = (name) => name.toLowerCase().replace(/[ _-]/g, "");
+
+/**
+ * Hash loosely matched name with FNV-1a. Must match miniucdHashAlias.
+ *
+ * @param namespace Property of value names, or zero for property names.
+ * @param name      Loosely matched name.
+ */
+function aliasHash(namespace, name) {
+  let hash = 0x811c9dc5;
+  for (const code of [namespace, ...[...name].map((c) => c.charCodeAt(0))]) {
+    hash = Math.imul(hash ^ code, 0x01000193) >>> 0;
+  }
+  return hash;
+}
+
+/**
+ * Build hash table of property and value aliases.
+ *
+ * Entries are sorted by bucket, and buckets give the index of their first
+ * entry.
+ *
+ * @return Table as { entries: [{ name, namespace, value }], buckets }.
+ */
+function buildAliasTable(properties, propertyAliases) {
+  const entries = new Map();
+  const addEntry = (namespace, alias, property, value) => {
+    const name = looseName(alias);
+    const key = `${namespace}:${name}`;
+    if (entries.has(key)) {
+      if (entries.get(key).value !== value) {
+        throw new Error(`Ambiguous alias ${alias} for ${property}`);
+      }
+      return;
+    }
+    entries.set(key, { name, namespace, property, value });
+  };
+
+  let number = 0;
+  for (const [property, info] of Object.entries(properties)) {
+    if (info.type === "deprecated") continue;
+    number++;
+
+    const PROPERTY = property.toUpperCase();
+    for (const alias of propertyAliases[property]) {
+      addEntry(0, alias, 0, `MINIUCD_${PROPERTY}`);
+    }
+    if (info.type !== "enum" || !info.values) continue;
+
+    for (const valueAliases of info.values) {
+      const VALUE = toConstant(valueAliases[0]);
+      for (const alias of valueAliases) {
+        addEntry(number, alias, `MINIUCD_${PROPERTY}`, `MINIUCD_${PROPERTY}_${VALUE}`);
+      }
+    }
+    (info.groups || []).forEach(({ aliases }, index) => {
+      for (const alias of aliases) {
+        addEntry(number, alias, `MINIUCD_${PROPERTY}`, `MINIUCD_${PROPERTY}_NBVALUES+${index + 1}`);
+      }
+    });
+  }
+
+  let nbBuckets = 1;
+  while (nbBuckets < entries.size) nbBuckets *= 2;
+  const bucketOf = ({ namespace, name }) =>
+    aliasHash(namespace, name) & (nbBuckets - 1);
+  const sorted = [...entries.values()].sort(
+    (a, b) => bucketOf(a) - bucketOf(b)
+  );
+  const buckets = [];
+  for (let bucket = 0, index = 0; bucket <= nbBuckets; bucket++) {
+    while (index < sorted.length && bucketOf(sorted[index]) < bucket) index++;
+    buckets.push(index);
+  }
+
+  return { entries: sorted, buckets };
+}
+
 /*
  * Parse PropertyValueAliases.txt and generate values for enumerated properties.
  */
@@ -218,7 +1219,13 @@ function parsePropertyValueAliases(properties) {
 
     if (property === "gc" && comment) {
       // Special case: don't define OR-ed General Category values (e.g.
-      // L/Letter = Ll | Lm | Lo | Lt | Lu).
+      // L/Letter = Ll | Lm | Lo | Lt | Lu), only record them as groups.
+      const aliases = [...new Set(split.slice(1).map((alias) => alias.trim()))];
+      const members = comment.split("|").map((member) => member.trim());
+      if (!properties[property].groups) {
+        properties[property].groups = [];
+      }
+      properties[property].groups.push({ aliases, members });
       continue;
     }
 
@@ -232,6 +1239,118 @@ function parsePropertyValueAliases(properties) {
   }
 }
 
+/**
+ * Get codepoint ranges of a UTF-8 automaton specification: a regc_ucd.inc
+ * class name, a property and value separated by '=' or ':', or a bare binary
+ * property, General Category or Script value. Names are matched loosely.
+ *
+ * @return Array of [first, last] codepoint ranges.
+ */
+function specRanges(spec, propertyValues, propertyAliases, regexClasses) {
+  const isAlias = (name) => (alias) => looseName(alias) === looseName(name);
+  const criteria = ([property, value]) => {
+    const info = properties[property];
+    if (info.type === "boolean") {
+      if (["y", "yes", "t", "true"].includes(looseName(value))) return /^Y$/;
+      if (["n", "no", "f", "false"].includes(looseName(value))) return /^N$/;
+      return null;
+    }
+    const values =
+      info.type === "enumList" ? properties[info.enumType].values : info.values;
+    const aliases = (values || []).find((aliases) =>
+      aliases.some(isAlias(value))
+    );
+    if (aliases) return new RegExp(`(^|,)${aliases[0]}(,|$)`);
+    const group = (info.groups || []).find(({ aliases }) =>
+      aliases.some(isAlias(value))
+    );
+    if (group) return new RegExp(`^(${group.members.join("|")})$`);
+    return null;
+  };
+
+  const [name, value] = spec.split(/[=:]/);
+  if (value === undefined && regexClasses.values[name]) {
+    return membersRanges(classMembers(regexClasses.values[name]));
+  }
+
+  // Candidate [property, value] pairs.
+  const named = Object.keys(properties).filter(
+    (property) =>
+      propertyValues[property] &&
+      properties[property].type !== "deprecated" &&
+      (propertyAliases[property] || []).some(isAlias(name))
+  );
+  const candidates =
+    value === undefined
+      ? [
+          ...named
+            .filter((property) => properties[property].type === "boolean")
+            .map((property) => [property, "Y"]),
+          ["gc", name],
+          ["sc", name],
+        ]
+      : named.map((property) => [property, value]);
+  const candidate = candidates.find(criteria);
+  if (!candidate) throw new Error(`Unknown class ${spec}`);
+  return membersRanges(
+    classMembers(
+      processClassCriteria(
+        { property: { [candidate[0]]: criteria(candidate) } },
+        propertyValues
+      )
+    )
+  );
+}
+
+/**
+ * Convert membership array to codepoint ranges.
+ *
+ * @return Array of [first, last] codepoint ranges.
+ */
+function membersRanges(members) {
+  const ranges = [];
+  for (let c = 0; c <= MAX_CODEPOINT; c++) {
+    if (!members[c]) continue;
+    let last = c;
+    while (last < MAX_CODEPOINT && members[last + 1]) last++;
+    ranges.push([c, last]);
+    c = last;
+  }
+  return ranges;
+}
+
+/**
+ * Generate UTF-8 automata for the given specifications as static C tables of
+ * MiniUCD_Utf8Transition, identical to the output of
+ * MiniUCD_CompileUtf8Automaton().
+ *
+ * @see specRanges
+ */
+function generateUtf8Automata(file, specs, propertyValues, propertyAliases) {
+  const regexClasses = buildRegexClasses(
+    classes,
+    classes_nocase,
+    propertyValues,
+    computeCaseOrbits(propertyValues)
+  );
+  const hex = (byte) => `0x${byte.toString(16).toUpperCase().padStart(2, "0")}`;
+  let content = `/*\n * UTF-8 automata generated by ucdGenerate.js from UCD ${version}.\n */\n`;
+  for (const spec of specs) {
+    const automaton = compileUtf8Automaton(
+      specRanges(spec, propertyValues, propertyAliases, regexClasses)
+    );
+    const transitions = automaton.map(
+      ({ first, last, end, next }) =>
+        `{${hex(first)}, ${hex(last)}, ${end}, ${next}}`
+    );
+    content += `\n/* ${spec} */\n`;
+    content += `static const MiniUCD_Utf8Transition utf8_${spec.replace(/[^A-Za-z0-9]+/g, "_")}[${automaton.length}] = {`;
+    content += formatArrayValues(transitions, 4);
+    content += `};\n`;
+  }
+  writeFileSync(file, content);
+}
+
 /**
  * Main generation function
  */
@@ -247,6 +1366,146 @@ function main() {
 
   parsePropertyValueAliases(properties);
 
+  // UTF-8 automata only: ucdGenerate.js --utf8 <file> <spec>...
+  if (process.argv[2] === "--utf8") {
+    console.log("Generating UTF-8 automata...");
+    generateUtf8Automata(
+      process.argv[3],
+      process.argv.slice(4),
+      propertyValues,
+      propertyAliases
+    );
+    console.log(`Done generating ${process.argv[3]}`);
+    return;
+  }
+
+  // Segmentation classes & state machines.
+  const graphemeBreakClasses = buildClassTable(
+    "graphemeBreak",
+    fuseProperties(
+      propertyValues,
+      ["GCB", "ExtPict", "InCB"],
+      graphemeBreakClass
+    )
+  );
+  const graphemeBreak = compileGraphemeBreak(
+    graphemeBreakClasses.classNames.map(parseGraphemeBreakClass)
+  );
+  const wordBreakClasses = buildClassTable(
+    "wordBreak",
+    fuseProperties(
+      propertyValues,
+      ["WB", "ExtPict"],
+      (WB, ExtPict) => (ExtPict === "Y" ? `${WB}_ExtPict` : WB)
+    )
+  );
+  const wordBreak = compileWordBreak(
+    wordBreakClasses.classNames.map((cls) => ({
+      wb: cls.replace(/_ExtPict$/, ""),
+      extPict: cls.endsWith("_ExtPict"),
+    }))
+  );
+  const sentenceBreak = compileSentenceBreak(
+    properties.SB.values.map((aliases) => aliases[0])
+  );
+  const syllableBreakClasses = buildClassTable(
+    "syllableBreak",
+    fuseProperties(
+      propertyValues,
+      ["InSC", "InCB", "GCB", "InPC"],
+      syllableClass
+    )
+  );
+  const syllableBreak = compileSyllableBreak(
+    syllableBreakClasses.classNames
+  );
+  const emojiClasses = buildClassTable(
+    "emojiSequence",
+    fuseProperties(
+      propertyValues,
+      ["Emoji", "EPres", "EMod", "EBase", "EComp", "ExtPict", "RI"],
+      emojiClass,
+      Object.keys(EMOJI_SINGLETONS).map(Number)
+    )
+  );
+  const emojiSequences = compileEmojiSequences(emojiClasses.classNames);
+  const joiningClasses = buildClassTable(
+    "joining",
+    fuseProperties(propertyValues, ["jt", "jg"], joiningClass)
+  );
+  const joining = compileJoining(joiningClasses.classNames);
+  const textFilterClasses = buildClassTable(
+    "textFilter",
+    fuseProperties(
+      propertyValues,
+      ["WSpace", "Pat_WS", "DI", "gc"],
+      textFilterClass,
+      JOINER_SINGLETONS
+    )
+  );
+  const ctypeClasses = buildClassTable(
+    "ctype",
+    fuseProperties(
+      propertyValues,
+      ["gc", "WSpace"],
+      ctypeClass,
+      CTYPE_SINGLETONS
+    )
+  );
+  const changesWhenClasses = buildClassTable(
+    "changesWhen",
+    fuseProperties(
+      propertyValues,
+      Object.keys(CHANGES_WHEN),
+      changesWhenClass
+    )
+  );
+  const lineBreakClasses = buildClassTable(
+    "lineBreak",
+    fuseProperties(
+      propertyValues,
+      ["lb", "ea", "gc", "ExtPict"],
+      (lb, ea, gc, ExtPict, cp) => lineBreakClass(lb, ea, gc, ExtPict, cp),
+      [DOTTED_CIRCLE, HYPHEN]
+    )
+  );
+  const lineBreak = compileLineBreak(
+    lineBreakClasses.classNames.map(parseLineBreakClass)
+  );
+
+  // Identifiers.
+  const identifierClasses = buildClassTable(
+    "identifier",
+    fuseProperties(
+      propertyValues,
+      ["XIDS", "XIDC", "NFKC_QC"],
+      identifierClass
+    )
+  );
+
+  // Script sets.
+  const scriptSets = buildScriptSets(properties.sc.values, propertyValues.scx);
+
+  // Decimal digits.
+  const zeros = digitZeros(propertyValues.nt, propertyValues.nv);
+
+  // Canonical combining classes.
+  checkCanonicalCombiningClasses(properties.ccc.values);
+
+  // Case orbits.
+  const caseOrbits = computeCaseOrbits(propertyValues);
+
+  // Display widths.
+  const widthTable = buildWidthTable(
+    fuseProperties(
+      propertyValues,
+      ["ea", "gc", "DI", "hst"],
+      displayWidth,
+      [SOFT_HYPHEN]
+    ),
+    lastCp
+  );
+
   ///////////////////////////////////////////////////////////////////////////
   // Generate miniucd.h
   ///////////////////////////////////////////////////////////////////////////
@@ -263,21 +1522,86 @@ function main() {
     toConstant,
     toHex,
     capitalize,
+    asciiValues,
+    classTables: [
+      graphemeBreakClasses,
+      wordBreakClasses,
+      lineBreakClasses,
+      syllableBreakClasses,
+      identifierClasses,
+      emojiClasses,
+      joiningClasses,
+      textFilterClasses,
+      ctypeClasses,
+      changesWhenClasses,
+    ],
+    changesWhen: {
+      flags: Object.values(CHANGES_WHEN),
+      asciiBounds: changesWhenAsciiBounds(changesWhenClasses),
+    },
+    segmentationFlags: flags,
+    stateMachines: {
+      graphemeBreak: {
+        ...graphemeBreak,
+        columns: "UCD_GRAPHEMEBREAK_NBCLASSES+1",
+      },
+      wordBreak: { ...wordBreak, columns: "UCD_WORDBREAK_NBCLASSES+1" },
+      sentenceBreak: { ...sentenceBreak, columns: "MINIUCD_SB_NBVALUES+1" },
+      lineBreak: { ...lineBreak, columns: "UCD_LINEBREAK_NBCLASSES+1" },
+      syllableBreak: {
+        ...syllableBreak,
+        columns: "UCD_SYLLABLEBREAK_NBCLASSES+1",
+      },
+    },
+    emojiSequences: {
+      ...emojiSequences,
+      types: emojiTypes,
+      flags: emojiFlags,
+    },
+    joining: { ...joining, forms: joiningForms, flags: joiningFlags },
+    widthTable,
+    scriptSets,
+    aliasTable: buildAliasTable(properties, propertyAliases),
+    caseOrbitTable: buildCaseOrbitTable(caseOrbits),
+    digitZeros: zeros,
+    gcAscii: asciiValues(propertyValues.gc),
+    parseRational,
   });
   writeFileSync(`${outputdir}/miniucd.h`, miniucdContent);
 
+  ///////////////////////////////////////////////////////////////////////////
+  // Generate miniucd.hpp
+  ///////////////////////////////////////////////////////////////////////////
+
+  console.log("Generating C++ header...");
+  const cppTemplate = readFileSync("./miniucd.tmpl.ejs.hpp").toString();
+  const cppContent = ejs.render(cppTemplate, {
+    version,
+    properties,
+    toConstant,
+  });
+  writeFileSync(`${outputdir}/miniucd.hpp`, cppContent);
+
   ///////////////////////////////////////////////////////////////////////////
   // Generate regc_ucd.inc
   ///////////////////////////////////////////////////////////////////////////
 
   console.log("Generating regex locale...");
   const regexTemplate = readFileSync("./regc_ucd.tmpl.ejs.inc").toString();
-  const regexContent = ejs.render(regexTemplate, {
+  const regexClasses = buildRegexClasses(
     classes,
     classes_nocase,
-    symbols,
     propertyValues,
-    processClassCriteria,
+    caseOrbits
+  );
+  const regexContent = ejs.render(regexTemplate, {
+    classes,
+    classes_nocase: regexClasses.nocase,
+    classValues: regexClasses.values,
+    symbols,
+    classTries: buildClassTries(regexClasses.values),
+    symbolsHash: buildPerfectHash(Object.keys(symbols)),
+    classesHash: buildPerfectHash(Object.keys(classes)),
     formatArrayValues,
   });
   writeFileSync(`${outputdir}/regc_ucd.inc`, regexContent);
@@ -5,6 +5,9 @@
  * Converted from coatlUcd_propertyTypes.tcl
  *
  * Adapted from PropertyAliases-16.0.0.txt and UAX #44
+ *
+ * Properties flagged with `ascii` also get a direct lookup table for ASCII
+ * characters, for properties used in hot loops.
  */
 
 export const properties = {
@@ -71,13 +74,13 @@ export const properties = {
   // ================================================
   age: { type: "enum" },
   blk: { type: "enum" },
-  sc: { type: "enum" },
+  sc: { type: "enum", ascii: true },
 
   // ================================================
   // Enumerated Properties
   // ================================================
-  bc: { type: "enum" },
-  bpt: { type: "enum" },
+  bc: { type: "enum", ascii: true },
+  bpt: { type: "enum", ascii: true },
   ccc: { type: "enum" },
   dt: { type: "enum" },
   ea: { type: "enum" },
@@ -95,8 +98,8 @@ export const properties = {
   NFKC_QC: { type: "enum" },
   NFKD_QC: { type: "enum" },
   nt: { type: "enum" },
-  SB: { type: "enum" },
-  vo: { type: "enum" },
+  SB: { type: "enum", ascii: true },
+  vo: { type: "enum", ascii: true },
   WB: { type: "enum" },
 
   // ================================================
@@ -0,0 +1,1277 @@
+/**
+ * @file ucdSegmentation.js
+ *
+ * Text segmentation rules from UAX #29, line breaking rules from UAX #14,
+ * Indic syllable rules, emoji sequences from UTS #51 and cursive joining
+ * rules, compiled to state machines.
+ *
+ * Rules are evaluated once at generation time for every (state, class) pair
+ * and the result is emitted as a C transition table, so that the runtime
+ * iterators only perform one table lookup per codepoint.
+ *
+ * @see http://unicode.org/reports/tr29/
+ * @see http://unicode.org/reports/tr14/
+ * @see http://unicode.org/reports/tr51/
+ * @see https://www.unicode.org/versions/latest/core-spec/chapter-9/#G7462
+ */
+
+/**
+ * Transition table entry flags. The lower bits give the next state.
+ */
+export const flags = {
+  /** Boundary before the current codepoint. */
+  BREAK: 0x100,
+  /** Boundary before the current codepoint depends on the next ones. */
+  DEFER: 0x200,
+  /** The previously deferred boundary resolves to a break. */
+  BREAK_DEFERRED: 0x400,
+  /** The boundary before the current codepoint is a mandatory line break. */
+  MANDATORY: 0x800,
+  /** No boundary before the current codepoint if it has the same script as
+   *  the start of the current syllable, else a boundary. */
+  SAME_SCRIPT: 0x1000,
+};
+
+/**
+ * Build transition table from rule function.
+ *
+ * @param states      State names; first one is the initial state.
+ * @param classes     Character classes.
+ * @param transition  Function (state, class) => { next, flags }.
+ *
+ * @return Array of rows (one per state) of numeric table entries.
+ */
+function compileTable(states, classes, transition) {
+  return states.map((state) =>
+    classes.map((cls) => {
+      const { next, flags } = transition(state, cls);
+      const index = states.indexOf(next);
+      if (index < 0) throw new Error(`Unknown state ${next}`);
+      return index | flags;
+    })
+  );
+}
+
+/**
+ * Compile rules expressed over structured left contexts.
+ *
+ * Reachable contexts are explored from the initial one, then equivalent
+ * contexts are merged (Moore's algorithm). Contexts with a pending boundary
+ * are kept apart from the others and numbered last.
+ *
+ * @param initial     Initial context.
+ * @param key         Function giving the canonical key of a context.
+ * @param columns     Table columns (character classes).
+ * @param transition  Function (context, column) => { next, flags }.
+ *
+ * @return { states, table, initial, pending }
+ */
+function compileContexts(initial, key, columns, transition) {
+  // Explore reachable contexts.
+  const contexts = [initial];
+  const indices = new Map([[key(initial), 0]]);
+  const transitions = [];
+  for (let i = 0; i < contexts.length; i++) {
+    transitions.push(
+      columns.map((c) => {
+        const { next, flags } = transition(contexts[i], c);
+        const k = key(next);
+        if (!indices.has(k)) {
+          indices.set(k, contexts.length);
+          contexts.push(next);
+        }
+        return { next: indices.get(k), flags };
+      })
+    );
+  }
+
+  // Merge equivalent contexts.
+  let partition = contexts.map((s) => (s.pending ? 1 : 0));
+  for (let nbBlocks = 0; ; ) {
+    const signatures = new Map();
+    const refined = transitions.map((row, i) => {
+      const signature = [
+        partition[i],
+        ...row.map(({ next, flags }) => `${partition[next]}:${flags}`),
+      ].join(",");
+      if (!signatures.has(signature)) {
+        signatures.set(signature, signatures.size);
+      }
+      return signatures.get(signature);
+    });
+    partition = refined;
+    if (signatures.size === nbBlocks) break;
+    nbBlocks = signatures.size;
+  }
+
+  // Number states in order of first appearance, pending ones last.
+  const order = contexts
+    .map((s, i) => i)
+    .sort((a, b) => !!contexts[a].pending - !!contexts[b].pending || a - b);
+  const stateOf = new Map();
+  const representatives = [];
+  for (const i of order) {
+    if (!stateOf.has(partition[i])) {
+      stateOf.set(partition[i], representatives.length);
+      representatives.push(i);
+    }
+  }
+  if (representatives.length > 256) throw new Error("Too many states");
+  const states = representatives.map((i) => key(contexts[i]));
+  const table = representatives.map((i) =>
+    transitions[i].map(
+      ({ next, flags }) => stateOf.get(partition[next]) | flags
+    )
+  );
+  return {
+    states,
+    table,
+    initial: stateOf.get(partition[0]),
+    pending: representatives.findIndex((i) => contexts[i].pending),
+  };
+}
+
+/**
+ * Get canonical key of a structured left context.
+ */
+function contextKey(s) {
+  return Object.entries(s)
+    .filter(([, value]) => value)
+    .map(([field, value]) => (value === true ? field : `${field}=${value}`))
+    .join(" ");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Grapheme cluster boundaries (UAX #29 section 3.1)
+///////////////////////////////////////////////////////////////////////////////
+
+// Left context at start of text.
+const gbInitial = { cls: "sot" };
+
+// Left context class for each Grapheme_Cluster_Break value, Hangul syllable
+// types being grouped as in GB7/GB8.
+const gbClassFor = {
+  CR: "CR",
+  LF: "Control",
+  CN: "Control",
+  PP: "Prepend",
+  L: "L",
+  V: "V",
+  LV: "V",
+  T: "T",
+  LVT: "T",
+};
+
+/**
+ * Grapheme cluster boundary transition.
+ *
+ * @param s   Left context: { cls, ep, incb, ri }, where ep tracks GB11
+ *            (ExtPict Extend* ZWJ?), incb tracks GB9c (Consonant followed
+ *            by InCB Extend/Linker, with at least one Linker), and ri is set
+ *            after an odd number of RIs (GB12/GB13).
+ * @param c   Class of next codepoint: { gcb, extPict, incb } or
+ *            { eot: true }.
+ *
+ * @return { next, flags }
+ */
+function graphemeBreakTransition(s, c) {
+  // GB1/GB2
+  if (c.eot) return { next: gbInitial, flags: flags.BREAK };
+
+  const next = {
+    cls: gbClassFor[c.gcb] || "Other",
+    ep: c.extPict
+      ? "ext"
+      : s.ep === "ext" && c.gcb === "EX"
+      ? "ext"
+      : s.ep === "ext" && c.gcb === "ZWJ"
+      ? "zwj"
+      : undefined,
+    incb:
+      c.incb === "Consonant"
+        ? "cons"
+        : s.incb && c.incb === "Linker"
+        ? "link"
+        : s.incb && c.incb === "Extend"
+        ? s.incb
+        : undefined,
+    ri: c.gcb === "RI" && !s.ri,
+  };
+  const attach = (rule) => ({ next, flags: rule ? 0 : flags.BREAK });
+
+  // GB3
+  if (s.cls === "CR" && c.gcb === "LF") return attach(true);
+  // GB4
+  if (["sot", "CR", "Control"].includes(s.cls)) return attach(false);
+  // GB5
+  if (["CR", "LF", "CN"].includes(c.gcb)) return attach(false);
+  // GB6
+  if (s.cls === "L" && ["L", "V", "LV", "LVT"].includes(c.gcb)) {
+    return attach(true);
+  }
+  // GB7
+  if (s.cls === "V" && ["V", "T"].includes(c.gcb)) return attach(true);
+  // GB8
+  if (s.cls === "T" && c.gcb === "T") return attach(true);
+  // GB9/GB9a
+  if (["EX", "ZWJ", "SM"].includes(c.gcb)) return attach(true);
+  // GB9b
+  if (s.cls === "Prepend") return attach(true);
+  // GB9c
+  if (s.incb === "link" && c.incb === "Consonant") return attach(true);
+  // GB11
+  if (s.ep === "zwj" && c.extPict) return attach(true);
+  // GB12/GB13
+  if (s.ri && c.gcb === "RI") return attach(true);
+  // GB999
+  return attach(false);
+}
+
+/**
+ * Compile grapheme cluster boundary rules.
+ *
+ * @param classes   Grapheme break classes, as { gcb, extPict, incb } objects.
+ *
+ * @return { states, table, initial }; the table has an extra column for the
+ *         end of text.
+ */
+export function compileGraphemeBreak(classes) {
+  const { states, table, initial } = compileContexts(
+    gbInitial,
+    contextKey,
+    [...classes, { eot: true }],
+    graphemeBreakTransition
+  );
+  return { states, table, initial };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Word boundaries (UAX #29 section 4.1)
+///////////////////////////////////////////////////////////////////////////////
+
+// Effective (WB4-collapsed) left context. The "ZWJ" variants record that the
+// last codepoint was a ZWJ, for WB3c.
+const wbBaseStates = [
+  "NL", // Start of text or after CR/LF/Newline (WB3a).
+  "CR",
+  "Other",
+  "WSeg", // WSegSpace, for WB3d.
+  "ALetter",
+  "Hebrew",
+  "Numeric",
+  "Katakana",
+  "ExtendNumLet",
+  "RI", // Odd number of RIs (WB15/WB16).
+  "ALMid", // AHLetter (MidLetter | MidNumLetQ), deferred (WB6/WB7).
+  "ALMidKeep", // Hebrew_Letter Single_Quote (WB7a).
+  "HLDQ", // Hebrew_Letter Double_Quote, deferred (WB7b/WB7c).
+  "NumMid", // Numeric (MidNum | MidNumLetQ), deferred (WB11/WB12).
+];
+const wbZwjStates = [
+  "Other",
+  "ALetter",
+  "Hebrew",
+  "Numeric",
+  "Katakana",
+  "ExtendNumLet",
+  "RI",
+  "ALMid",
+  "ALMidKeep",
+  "HLDQ",
+  "NumMid",
+];
+const wbPendingStates = ["ALMid", "HLDQ", "NumMid"];
+
+const wbStateFor = {
+  LE: "ALetter",
+  HL: "Hebrew",
+  NU: "Numeric",
+  KA: "Katakana",
+  EX: "ExtendNumLet",
+  RI: "RI",
+  WSegSpace: "WSeg",
+};
+
+/**
+ * Word boundary rules.
+ *
+ * @param state   Current state.
+ * @param cls     Class of next codepoint: { wb, extPict } or { eot: true }.
+ */
+function wordBreakTransition(state, cls) {
+  const zwj = state.endsWith("+ZWJ");
+  const base = zwj ? state.slice(0, -4) : state;
+  const pending = wbPendingStates.includes(base);
+  const { wb, extPict } = cls;
+
+  // WB2
+  if (cls.eot) {
+    return {
+      next: "NL",
+      flags: flags.BREAK | (pending ? flags.BREAK_DEFERRED : 0),
+    };
+  }
+
+  // WB3
+  if (base === "CR" && wb === "LF") return { next: "NL", flags: 0 };
+
+  // WB3a
+  if (base === "CR" || base === "NL") {
+    const next = ["CR", "LF", "NL"].includes(wb)
+      ? wb === "CR"
+        ? "CR"
+        : "NL"
+      : wb === "Extend" || wb === "FO"
+      ? "Other"
+      : wb === "ZWJ"
+      ? "Other+ZWJ"
+      : wbStateFor[wb] || "Other";
+    return { next, flags: flags.BREAK };
+  }
+
+  // WB3b
+  if (["CR", "LF", "NL"].includes(wb)) {
+    return {
+      next: wb === "CR" ? "CR" : "NL",
+      flags: flags.BREAK | (pending ? flags.BREAK_DEFERRED : 0),
+    };
+  }
+
+  // WB3c, WB3d
+  const keep = (zwj && extPict) || (base === "WSeg" && wb === "WSegSpace");
+
+  // WB4: deferred boundaries stay pending.
+  if (["Extend", "FO", "ZWJ"].includes(wb)) {
+    const next = base === "WSeg" ? "Other" : base;
+    return { next: wb === "ZWJ" ? `${next}+ZWJ` : next, flags: 0 };
+  }
+
+  const AHLetter = wb === "LE" || wb === "HL";
+  const MidNumLetQ = wb === "MB" || wb === "SQ";
+  let next = wbStateFor[wb] || "Other";
+
+  // Resolve deferred boundary.
+  let prev = base;
+  let resolved = 0;
+  if (pending) {
+    const joins =
+      base === "ALMid"
+        ? AHLetter // WB6, WB7
+        : base === "HLDQ"
+        ? wb === "HL" // WB7b, WB7c
+        : wb === "NU"; // WB11, WB12
+    if (joins) return { next, flags: 0 };
+    resolved = flags.BREAK_DEFERRED;
+    prev = "Other";
+  }
+
+  const noBreak = { next, flags: resolved };
+  switch (prev) {
+    case "ALetter":
+    case "Hebrew":
+      if (AHLetter) return noBreak; // WB5
+      if (wb === "NU") return noBreak; // WB9
+      if (wb === "EX") return noBreak; // WB13a
+      if (prev === "Hebrew" && wb === "SQ") {
+        return { next: "ALMidKeep", flags: resolved }; // WB7a
+      }
+      if (wb === "ML" || MidNumLetQ) {
+        return { next: "ALMid", flags: resolved | flags.DEFER }; // WB6
+      }
+      if (prev === "Hebrew" && wb === "DQ") {
+        return { next: "HLDQ", flags: resolved | flags.DEFER }; // WB7b
+      }
+      break;
+
+    case "ALMidKeep":
+      if (AHLetter) return noBreak; // WB7
+      break;
+
+    case "Numeric":
+      if (wb === "NU") return noBreak; // WB8
+      if (AHLetter) return noBreak; // WB10
+      if (wb === "EX") return noBreak; // WB13a
+      if (wb === "MN" || MidNumLetQ) {
+        return { next: "NumMid", flags: resolved | flags.DEFER }; // WB12
+      }
+      break;
+
+    case "Katakana":
+      if (wb === "KA") return noBreak; // WB13
+      if (wb === "EX") return noBreak; // WB13a
+      break;
+
+    case "ExtendNumLet":
+      if (wb === "EX") return noBreak; // WB13a
+      if (AHLetter || wb === "NU" || wb === "KA") return noBreak; // WB13b
+      break;
+
+    case "RI":
+      if (wb === "RI") return { next: "Other", flags: resolved }; // WB15, WB16
+      break;
+  }
+
+  // WB999
+  return { next, flags: resolved | (keep ? 0 : flags.BREAK) };
+}
+
+/**
+ * Compile word boundary rules.
+ *
+ * @param classes   Word break classes, as { wb, extPict } objects.
+ *
+ * @return { states, table, initial }; the table has an extra column for the
+ *         end of text.
+ */
+export function compileWordBreak(classes) {
+  const states = [
+    ...wbBaseStates,
+    ...wbZwjStates.map((state) => `${state}+ZWJ`),
+  ];
+  const table = compileTable(
+    states,
+    [...classes, { eot: true }],
+    wordBreakTransition
+  );
+  return { states, table, initial: states.indexOf("NL") };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Sentence boundaries (UAX #29 section 5.1)
+///////////////////////////////////////////////////////////////////////////////
+
+const sbStates = [
+  "ParaSep", // Start of text or after ParaSep (SB4).
+  "CR",
+  "Other",
+  "UL", // Upper or Lower, for SB7.
+  "AT", // ATerm.
+  "ULAT", // (Upper | Lower) ATerm, for SB7.
+  "ATClose", // ATerm Close+
+  "ATSp", // ATerm Close* Sp+
+  "AT8", // ATerm Close* Sp* (¬(OLetter | Upper | Lower | ParaSep | SATerm))+, deferred (SB8).
+  "ST", // STerm.
+  "STClose", // STerm Close+
+  "STSp", // STerm Close* Sp+
+];
+
+/**
+ * Sentence boundary rules.
+ *
+ * @param state   Current state.
+ * @param cls     Class of next codepoint: { sb } or { eot: true }.
+ */
+function sentenceBreakTransition(state, cls) {
+  const pending = state === "AT8";
+  const { sb } = cls;
+
+  // SB2
+  if (cls.eot) {
+    return {
+      next: "ParaSep",
+      flags: flags.BREAK | (pending ? flags.BREAK_DEFERRED : 0),
+    };
+  }
+
+  const ParaSep = sb === "SE" || sb === "CR" || sb === "LF";
+  const SATerm = sb === "AT" || sb === "ST";
+  const stateFor = () =>
+    ParaSep
+      ? sb === "CR"
+        ? "CR"
+        : "ParaSep"
+      : sb === "UP" || sb === "LO"
+      ? "UL"
+      : sb === "AT"
+      ? "AT"
+      : sb === "ST"
+      ? "ST"
+      : "Other";
+
+  // SB3
+  if (state === "CR" && sb === "LF") return { next: "ParaSep", flags: 0 };
+
+  // SB4
+  if (state === "CR" || state === "ParaSep") {
+    return { next: stateFor(), flags: flags.BREAK };
+  }
+
+  // SB5: deferred boundaries stay pending.
+  if (sb === "EX" || sb === "FO") return { next: state, flags: 0 };
+
+  const noBreak = { next: stateFor(), flags: 0 };
+  switch (state) {
+    case "UL":
+      if (sb === "AT") return { next: "ULAT", flags: 0 };
+      return noBreak;
+
+    case "AT":
+    case "ULAT":
+    case "ATClose":
+    case "ATSp": {
+      // SB6
+      if (sb === "NU" && state !== "ATClose" && state !== "ATSp") {
+        return noBreak;
+      }
+      // SB7
+      if (sb === "UP" && state === "ULAT") return noBreak;
+      // SB8 (zero-length look-ahead)
+      if (sb === "LO") return noBreak;
+      // SB8a
+      if (sb === "SC" || SATerm) return noBreak;
+      // SB9
+      if (sb === "CL" && state !== "ATSp") {
+        return { next: "ATClose", flags: 0 };
+      }
+      // SB9, SB10
+      if (sb === "SP") return { next: "ATSp", flags: 0 };
+      if (ParaSep) return noBreak;
+      // SB8 look-ahead
+      if (sb !== "LE" && sb !== "UP") return { next: "AT8", flags: flags.DEFER };
+      // SB11
+      return { next: stateFor(), flags: flags.BREAK };
+    }
+
+    case "AT8":
+      // SB8
+      if (sb === "LO") return noBreak;
+      if (!ParaSep && !SATerm && sb !== "LE" && sb !== "UP") {
+        return { next: "AT8", flags: 0 };
+      }
+      // SB11
+      return { next: stateFor(), flags: flags.BREAK_DEFERRED };
+
+    case "ST":
+    case "STClose":
+    case "STSp":
+      // SB8a
+      if (sb === "SC" || SATerm) return noBreak;
+      // SB9
+      if (sb === "CL" && state !== "STSp") {
+        return { next: "STClose", flags: 0 };
+      }
+      // SB9, SB10
+      if (sb === "SP") return { next: "STSp", flags: 0 };
+      if (ParaSep) return noBreak;
+      // SB11
+      return { next: stateFor(), flags: flags.BREAK };
+  }
+
+  // SB998
+  return noBreak;
+}
+
+/**
+ * Compile sentence boundary rules.
+ *
+ * @param values    Sentence_Break property values, in enum order.
+ *
+ * @return { states, table, initial }; table columns are indexed by property
+ *         value, column 0 is for the end of text.
+ */
+export function compileSentenceBreak(values) {
+  const table = compileTable(
+    sbStates,
+    [{ eot: true }, ...values.map((sb) => ({ sb }))],
+    sentenceBreakTransition
+  );
+  return { states: sbStates, table, initial: sbStates.indexOf("ParaSep") };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Line breaking opportunities (UAX #14 section 6)
+///////////////////////////////////////////////////////////////////////////////
+
+const NONE = 0;
+const BREAK = 1;
+const MANDATORY = 2;
+
+// Look-ahead rules: the boundary before the current codepoint gets the given
+// action if the next (LB9-collapsed) codepoint matches, and the opposite one
+// otherwise.
+const lbLookahead = {
+  // LB15b
+  QUPf: {
+    action: NONE,
+    matches: (c) =>
+      c.eot ||
+      [
+        "SP", "GL", "WJ", "CL", "QU", "CP", "EX", "IS", "SY", "BK", "CR",
+        "LF", "NL", "ZW",
+      ].includes(c.lb),
+  },
+  // LB15c
+  IS: { action: BREAK, matches: (c) => c.lb === "NU" },
+  // LB19a
+  QUPi: { action: NONE, matches: (c) => c.eot || !c.ea },
+  // LB25: (PR | PO) × OP IS? NU, the IS case carrying the look-ahead over.
+  OPNU: { action: NONE, matches: (c) => c.lb === "NU" },
+  OPISNU: { action: NONE, matches: (c) => c.lb === "NU" },
+  // LB28a
+  VF: { action: NONE, matches: (c) => c.lb === "VF" },
+};
+
+// Classes of left context that still matter across spaces (LB8, LB14, LB16,
+// LB17).
+const lbSpaceContexts = ["ZW", "OP", "CL", "CP", "B2"];
+
+const lbAksara = (cls, dc) => cls === "AK" || cls === "AS" || dc;
+
+/**
+ * Line breaking rules, for the boundary between left context and codepoint.
+ *
+ * @param s   Left context.
+ * @param c   Codepoint class, with LB1 and LB10 applied.
+ *
+ * @return { action, lookahead } where lookahead is the look-ahead rule, if
+ *         any, the action depends on.
+ */
+function lineBreakRules(s, c) {
+  const { lb } = c;
+  const before = s.cls; // Class before spaces, if any.
+  const prev = s.sp ? "SP" : s.cls; // Class immediately before.
+  let lookahead = null;
+  const rule = (action) => ({ action, lookahead });
+  const lookaheadRule = (name) => {
+    if (lookahead) throw new Error(`Conflicting look-ahead rules ${name}`);
+    lookahead = name;
+  };
+
+  // LB2
+  if (prev === "sot") return rule(NONE);
+  // LB4, LB5
+  if (before === "BK") return rule(MANDATORY);
+  if (before === "CR") return rule(lb === "LF" ? NONE : MANDATORY);
+  // LB6
+  if (["BK", "CR", "LF", "NL"].includes(lb)) return rule(NONE);
+  // LB7
+  if (lb === "SP" || lb === "ZW") return rule(NONE);
+  // LB8
+  if (before === "ZW") return rule(BREAK);
+  // LB8a
+  if (s.zwj) return rule(NONE);
+  // LB11
+  if (lb === "WJ" || prev === "WJ") return rule(NONE);
+  // LB12
+  if (prev === "GL") return rule(NONE);
+  // LB12a
+  if (lb === "GL" && !["SP", "BA", "HY"].includes(prev)) return rule(NONE);
+  // LB13
+  if (["CL", "CP", "EX", "SY"].includes(lb)) return rule(NONE);
+  // LB14
+  if (before === "OP") return rule(NONE);
+  // LB15a
+  if (s.piOpen) return rule(NONE);
+  // LB15b
+  if (lb === "QU" && c.pf) lookaheadRule("QUPf");
+  // LB15c, LB15d
+  if (lb === "IS") {
+    if (s.sp) lookaheadRule("IS");
+    return rule(NONE);
+  }
+  // LB16
+  if ((before === "CL" || before === "CP") && lb === "NS") return rule(NONE);
+  // LB17
+  if (before === "B2" && lb === "B2") return rule(NONE);
+  // LB18
+  if (s.sp) return rule(BREAK);
+  // LB19
+  if (lb === "QU" && !c.pi) return rule(NONE);
+  if (prev === "QU" && !s.pf) return rule(NONE);
+  // LB19a
+  if (lb === "QU") {
+    if (!s.ea) return rule(NONE);
+    lookaheadRule("QUPi");
+  }
+  if (prev === "QU" && (!c.ea || s.quStart)) return rule(NONE);
+  // LB20
+  if (lb === "CB" || prev === "CB") return rule(BREAK);
+  // LB20a
+  if (s.hyStart && (lb === "AL" || lb === "HL")) return rule(NONE);
+  // LB21
+  if (["BA", "HY", "NS"].includes(lb) || prev === "BB") return rule(NONE);
+  // LB21a
+  if (s.hlHy && lb !== "HL") return rule(NONE);
+  // LB21b
+  if (prev === "SY" && lb === "HL") return rule(NONE);
+  // LB22
+  if (lb === "IN") return rule(NONE);
+  // LB23
+  if ((prev === "AL" || prev === "HL") && lb === "NU") return rule(NONE);
+  if (prev === "NU" && (lb === "AL" || lb === "HL")) return rule(NONE);
+  // LB23a
+  if (prev === "PR" && ["ID", "EB", "EM"].includes(lb)) return rule(NONE);
+  if (["ID", "EB", "EM"].includes(prev) && lb === "PO") return rule(NONE);
+  // LB24
+  if ((prev === "PR" || prev === "PO") && (lb === "AL" || lb === "HL")) {
+    return rule(NONE);
+  }
+  if ((prev === "AL" || prev === "HL") && (lb === "PR" || lb === "PO")) {
+    return rule(NONE);
+  }
+  // LB25
+  if ((prev === "PR" || prev === "PO") && lb === "NU") return rule(NONE);
+  if ((prev === "PR" || prev === "PO") && lb === "OP") lookaheadRule("OPNU");
+  if (["OP", "HY", "IS"].includes(prev) && lb === "NU") return rule(NONE);
+  if (s.num && ["NU", "SY", "IS", "CL", "CP"].includes(lb)) return rule(NONE);
+  if ((s.num || s.numClose) && (lb === "PO" || lb === "PR")) return rule(NONE);
+  // LB26
+  if (prev === "JL" && ["JL", "JV", "H2", "H3"].includes(lb)) return rule(NONE);
+  if ((prev === "JV" || prev === "H2") && (lb === "JV" || lb === "JT")) {
+    return rule(NONE);
+  }
+  if ((prev === "JT" || prev === "H3") && lb === "JT") return rule(NONE);
+  // LB27
+  const korean = ["JL", "JV", "JT", "H2", "H3"];
+  if (korean.includes(prev) && lb === "PO") return rule(NONE);
+  if (prev === "PR" && korean.includes(lb)) return rule(NONE);
+  // LB28
+  if ((prev === "AL" || prev === "HL") && (lb === "AL" || lb === "HL")) {
+    return rule(NONE);
+  }
+  // LB28a
+  const aksara = lbAksara(lb, c.dc);
+  if (prev === "AP" && aksara) return rule(NONE);
+  if (lbAksara(prev, s.dc) && (lb === "VF" || lb === "VI")) return rule(NONE);
+  if (s.akVI && (lb === "AK" || c.dc)) return rule(NONE);
+  if (lbAksara(prev, s.dc) && aksara) lookaheadRule("VF");
+  // LB29
+  if (prev === "IS" && (lb === "AL" || lb === "HL")) return rule(NONE);
+  // LB30
+  if (["AL", "HL", "NU"].includes(prev) && lb === "OP" && !c.ea) {
+    return rule(NONE);
+  }
+  if (prev === "CP" && !s.ea && ["AL", "HL", "NU"].includes(lb)) {
+    return rule(NONE);
+  }
+  // LB30a
+  if (s.riOdd && lb === "RI") return rule(NONE);
+  // LB30b
+  if ((prev === "EB" || s.epcn) && lb === "EM") return rule(NONE);
+  // LB31
+  return rule(BREAK);
+}
+
+// Left context at start of text.
+const lbInitial = { cls: "sot" };
+
+/**
+ * Line breaking transition.
+ *
+ * @param s   Left context.
+ * @param c   Class of next codepoint: { lb, ea, pi, pf, dc, hh, epcn } or
+ *            { eot: true }.
+ *
+ * @return { next, flags }
+ */
+function lineBreakTransition(s, c) {
+  let resolved = 0;
+
+  // LB9: attach combining marks; deferred boundaries stay pending.
+  const attached =
+    (c.lb === "CM" || c.lb === "ZWJ") &&
+    !s.sp &&
+    !["sot", "BK", "CR", "ZW"].includes(s.cls);
+  if (attached) return { next: { ...s, zwj: c.lb === "ZWJ" }, flags: 0 };
+
+  // Resolve deferred boundary, or keep it pending over the optional IS of
+  // LB25.
+  let carried;
+  if (s.pending === "OPNU" && c.lb === "IS") {
+    carried = "OPISNU";
+    s = { ...s, pending: undefined };
+  } else if (s.pending) {
+    const { action, matches } = lbLookahead[s.pending];
+    if ((matches(c) ? action : NONE + BREAK - action) === BREAK) {
+      resolved = flags.BREAK_DEFERRED;
+    }
+    s = { ...s, pending: undefined };
+  }
+
+  // LB3
+  if (c.eot) {
+    const empty = s.cls === "sot" && !s.sp;
+    return {
+      next: lbInitial,
+      flags: resolved | (empty ? 0 : flags.BREAK | flags.MANDATORY),
+    };
+  }
+
+  // LB1, LB10
+  const lb = { AI: "AL", CJ: "NS", CM: "AL", ZWJ: "AL" }[c.lb] || c.lb;
+  const cls = { ...c, lb };
+
+  // Look-ahead rules only need deferring when the outcome depends on it.
+  const rules = lineBreakRules(s, cls);
+  const { action } = rules;
+  const lookahead =
+    rules.lookahead && lbLookahead[rules.lookahead].action !== action
+      ? rules.lookahead
+      : undefined;
+  let entryFlags = resolved;
+  if (lookahead && carried) throw new Error("Conflicting deferred breaks");
+  if (lookahead) {
+    if (action === MANDATORY) throw new Error("Deferred mandatory break");
+    entryFlags |= flags.DEFER;
+  } else if (action !== NONE) {
+    entryFlags |= flags.BREAK | (action === MANDATORY ? flags.MANDATORY : 0);
+  }
+
+  // Next left context.
+  let next;
+  if (lb === "SP") {
+    next = {
+      cls: lbSpaceContexts.includes(s.cls) ? s.cls : "Other",
+      sp: true,
+      piOpen: s.piOpen,
+    };
+  } else if (["BK", "LF", "NL"].includes(lb)) {
+    next = { cls: "BK" };
+  } else if (lb === "CR") {
+    next = { cls: "CR" };
+  } else {
+    const prev = s.sp ? "SP" : s.cls;
+    const { ea } = c;
+    const wordStart = ["sot", "BK", "CR", "SP", "ZW", "CB", "GL"].includes(prev);
+    const num =
+      lb === "NU" || ((lb === "SY" || lb === "IS") && !s.sp && s.num);
+    next = {
+      cls: lb,
+      ea,
+      zwj: c.lb === "ZWJ",
+      pf: lb === "QU" && c.pf,
+      // LB15a
+      piOpen:
+        lb === "QU" &&
+        c.pi &&
+        ["sot", "BK", "CR", "OP", "QU", "GL", "SP", "ZW"].includes(prev),
+      // LB19a
+      quStart: lb === "QU" && (prev === "sot" || prev === "SP" || !s.ea),
+      // LB20a
+      hyStart: (lb === "HY" || c.hh) && wordStart,
+      // LB21a
+      hlHy: (lb === "HY" || (lb === "BA" && !c.ea)) && prev === "HL",
+      // LB25
+      num,
+      numClose: (lb === "CL" || lb === "CP") && !s.sp && s.num,
+      // LB28a
+      dc: c.dc,
+      akVI: lb === "VI" && lbAksara(prev, s.dc),
+      // LB30a
+      riOdd: lb === "RI" && !(prev === "RI" && s.riOdd),
+      // LB30b
+      epcn: c.epcn,
+      pending: lookahead || carried,
+    };
+  }
+  return { next, flags: entryFlags };
+}
+
+/**
+ * Compile line breaking rules.
+ *
+ * Rows of the resulting table are left contexts: the class before the break
+ * opportunity, extended with whatever state the contextual rules need. They
+ * are discovered by exploring all reachable contexts from the start of text,
+ * then merged when equivalent, so the table is the classic pair table with
+ * only as many extra rows as needed.
+ *
+ * @param classes   Line break classes, as { lb, ea, pi, pf, dc, hh, epcn }
+ *                  objects, with LB1 applied except for AI and CJ.
+ *
+ * @return { states, table, initial, pending }; the table has an extra column
+ *         for the end of text, and states with a deferred boundary are
+ *         numbered from pending onwards.
+ */
+export function compileLineBreak(classes) {
+  return compileContexts(
+    lbInitial,
+    contextKey,
+    [...classes, { eot: true }],
+    lineBreakTransition
+  );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Indic syllables
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Syllable categories:
+ *
+ * - C: consonant, can follow a linking virama.
+ * - P: consonant placeholder (e.g. dotted circle), a base for marks only.
+ * - V: independent vowel and other standalone bases.
+ * - R: preceding repha, attaches to the following consonant.
+ * - VL: dependent vowel written before its consonant in logical order
+ *   (Indic_Positional_Category=Visual_Order_Left, e.g. Thai and Lao),
+ *   attaches to the following consonant.
+ * - N: nukta.
+ * - M: dependent vowel, modifier and other mark attaching to its base.
+ * - HL: virama linking consonants into a conjunct (InCB=Linker, or
+ *   invisible stacker).
+ * - H: virama that doesn't link (e.g. Tamil pulli), a mark.
+ * - ZWJ, ZWNJ: joiners; ZWJ keeps a link, ZWNJ cuts it.
+ * - EX: non-Indic extending character (Grapheme_Cluster_Break Extend or
+ *   SpacingMark), attaches to anything.
+ * - CR, LF: kept together.
+ * - Other: anything else.
+ *
+ * Consonants only join a conjunct, a repha or a leading vowel of the same
+ * script (SAME_SCRIPT flag, checked at runtime).
+ */
+const syllableStates = [
+  "Start", // Start of text.
+  "Other", // After a non-syllable character.
+  "CR",
+  "Base", // Within a syllable.
+  "Link", // After a linking virama: next consonant joins the syllable.
+  "Repha", // After a preceding repha.
+  "Left", // After a leading vowel.
+];
+
+/**
+ * Syllable boundary rules.
+ *
+ * @param state   Current state.
+ * @param cls     Syllable category of next codepoint, or { eot: true }.
+ */
+function syllableBreakTransition(state, cls) {
+  const attach = (next) => ({ next, flags: 0 });
+  const start = (next) => ({ next, flags: flags.BREAK });
+  const join = (next) => ({ next, flags: flags.SAME_SCRIPT });
+
+  if (state === "CR" && cls === "LF") return attach("Other");
+  if (state === "Start" || state === "CR") {
+    // Always a boundary at start of text and after CR.
+    return start(syllableBreakTransition("Other", cls).next);
+  }
+  if (cls.eot) return start("Other");
+  const inSyllable = ["Base", "Link", "Repha", "Left"].includes(state);
+  switch (cls) {
+    case "C":
+      return state === "Link" || state === "Repha" || state === "Left"
+        ? join("Base")
+        : start("Base");
+    case "P":
+    case "V":
+      return state === "Repha" || state === "Left"
+        ? join("Base")
+        : start("Base");
+    case "R":
+      return start("Repha");
+    case "VL":
+      return start("Left");
+    case "N":
+    case "M":
+    case "H":
+      return inSyllable ? attach("Base") : start("Base");
+    case "HL":
+      return inSyllable ? attach("Link") : start("Base");
+    case "ZWJ":
+      return attach(state);
+    case "ZWNJ":
+      return attach(inSyllable ? "Base" : "Other");
+    case "EX":
+      return attach(inSyllable ? "Base" : state);
+    case "CR":
+      return start("CR");
+    default:
+      return start("Other");
+  }
+}
+
+/**
+ * Compile Indic syllable boundary rules.
+ *
+ * @param classes   Syllable categories.
+ *
+ * @return { states, table, initial }; the table has an extra column for the
+ *         end of text.
+ */
+export function compileSyllableBreak(classes) {
+  const table = compileTable(
+    syllableStates,
+    [...classes, { eot: true }],
+    syllableBreakTransition
+  );
+  return { states: syllableStates, table, initial: 0 };
+}
+
+/*
+ * Emoji sequences.
+ *
+ * Sequences are recognized from their first codepoint by a DFA over these
+ * emoji classes:
+ *
+ * - Text, TextBase: Emoji with text presentation by default, modifier base or
+ *   not.
+ * - Pres, PresBase: Emoji with emoji presentation by default, modifier base or
+ *   not.
+ * - Mod: emoji modifiers (skin tones).
+ * - KeycapBase: 0-9, # and *.
+ * - RI: regional indicators.
+ * - VS15, VS16: text and emoji presentation selectors.
+ * - Keycap: U+20E3 COMBINING ENCLOSING KEYCAP.
+ * - ZWJ: U+200D ZERO WIDTH JOINER.
+ * - Tag, TagEnd: tag characters and CANCEL TAG.
+ * - Other: anything else.
+ */
+
+/** Emoji sequence types, in the order of the public enum. */
+export const emojiTypes = ["BASIC", "KEYCAP", "MODIFIER", "FLAG", "TAG", "ZWJ"];
+
+/**
+ * Emoji transition table entry flags. The lower bits give the next state.
+ */
+export const emojiFlags = {
+  /** Shift for the type of the sequence ending with the current codepoint. */
+  TYPE_SHIFT: 8,
+  /** Mask for the type of the sequence ending with the current codepoint. */
+  TYPE: 0x700,
+  /** The codepoints so far don't form a sequence (text presentation). */
+  REJECT: 0x800,
+};
+
+const emojiStates = [
+  "Start",
+  "End", // No longer sequence possible.
+  "Text", // Text presentation emoji, not yet a sequence.
+  "TextBase", // Same, modifier base.
+  "Elem", // Emoji, possibly followed by VS16, modifier, tags or ZWJ.
+  "ElemBase", // Same, modifier base.
+  "ElemDone", // Emoji followed by VS16 or modifier.
+  "Keycap", // Keycap base.
+  "KeycapVS", // Keycap base followed by VS16.
+  "RI", // First regional indicator of a flag.
+  "Tag", // Within tag specification.
+  "Zwj", // After ZWJ, expecting the next element.
+  "ZwjElem", // Element of ZWJ sequence.
+  "ZwjElemBase", // Same, modifier base.
+  "ZwjElemDone", // Element of ZWJ sequence followed by VS16 or modifier.
+];
+
+/**
+ * Emoji sequence rules (UTS #51 section 1.4).
+ *
+ * Single emoji characters only form a sequence when presented as emoji, i.e.
+ * when they have emoji presentation by default or are followed by VS16.
+ * Keycap sequences are also accepted without VS16, and so are the characters
+ * of ZWJ sequences, as renderers do.
+ *
+ * @param state   Current state.
+ * @param cls     Emoji class of next codepoint.
+ */
+function emojiTransition(state, cls) {
+  const type = (name) => (emojiTypes.indexOf(name) + 1) << emojiFlags.TYPE_SHIFT;
+  const go = (next) => ({ next, flags: 0 });
+  const accept = (next, name) => ({ next, flags: type(name) });
+  const reject = () => ({ next: "End", flags: emojiFlags.REJECT });
+  const zwj = state.startsWith("Zwj");
+
+  switch (state) {
+    case "Start":
+      switch (cls) {
+        case "Text":
+          return go("Text");
+        case "TextBase":
+          return go("TextBase");
+        case "Pres":
+        case "Mod":
+          return accept("Elem", "BASIC");
+        case "PresBase":
+          return accept("ElemBase", "BASIC");
+        case "KeycapBase":
+          return go("Keycap");
+        case "RI":
+          return go("RI");
+      }
+      return go("End");
+
+    case "Text":
+    case "TextBase":
+    case "Elem":
+    case "ElemBase":
+    case "ZwjElem":
+    case "ZwjElemBase":
+      switch (cls) {
+        case "VS16":
+          return accept(zwj ? "ZwjElemDone" : "ElemDone", zwj ? "ZWJ" : "BASIC");
+        case "VS15":
+          return state.startsWith("Elem") ? reject() : go("End");
+        case "Mod":
+          if (state === "TextBase" || state === "ElemBase") {
+            return accept("ElemDone", "MODIFIER");
+          }
+          if (state === "ZwjElemBase") return accept("ZwjElemDone", "ZWJ");
+          break;
+        case "ZWJ":
+          return go("Zwj");
+        case "Tag":
+          if (!zwj) return go("Tag");
+          break;
+      }
+      return go("End");
+
+    case "ElemDone":
+    case "ZwjElemDone":
+      if (cls === "ZWJ") return go("Zwj");
+      if (cls === "Tag" && !zwj) return go("Tag");
+      return go("End");
+
+    case "Keycap":
+      if (cls === "VS16") return accept("KeycapVS", "BASIC");
+      if (cls === "Keycap") return accept("End", "KEYCAP");
+      return go("End");
+
+    case "KeycapVS":
+      if (cls === "Keycap") return accept("End", "KEYCAP");
+      return go("End");
+
+    case "RI":
+      if (cls === "RI") return accept("End", "FLAG");
+      return go("End");
+
+    case "Tag":
+      if (cls === "Tag") return go("Tag");
+      if (cls === "TagEnd") return accept("End", "TAG");
+      return go("End");
+
+    case "Zwj":
+      switch (cls) {
+        case "Text":
+        case "Pres":
+        case "Mod":
+        case "KeycapBase":
+          return accept("ZwjElem", "ZWJ");
+        case "TextBase":
+        case "PresBase":
+          return accept("ZwjElemBase", "ZWJ");
+      }
+      return go("End");
+  }
+  return go("End");
+}
+
+/**
+ * Compile emoji sequence rules.
+ *
+ * @param classes   Emoji classes.
+ *
+ * @return { states, table, initial, end }
+ */
+export function compileEmojiSequences(classes) {
+  const table = compileTable(emojiStates, classes, emojiTransition);
+  return {
+    states: emojiStates,
+    table,
+    initial: emojiStates.indexOf("Start"),
+    end: emojiStates.indexOf("End"),
+  };
+}
+
+/*
+ * Cursive joining.
+ *
+ * Joining forms are resolved from these joining classes:
+ *
+ * - U, L, R, D: Joining_Type values, with Join_Causing folded into D.
+ * - T: transparent characters, skipped.
+ * - Alaph, Dalath_Rish: right-joining Syriac letters whose final forms depend
+ *   on the preceding letter (Joining_Group values).
+ */
+
+/** Joining forms, in the order of the public enum (from 0). */
+export const joiningForms = [
+  "NONE",
+  "ISOL",
+  "FINA",
+  "FIN2",
+  "FIN3",
+  "MEDI",
+  "MED2",
+  "INIT",
+];
+
+/**
+ * Joining transition table entry flags. The lower bits give the next state.
+ */
+export const joiningFlags = {
+  /** Shift for the new form of the previous joining character, if any. */
+  PREVIOUS_SHIFT: 8,
+  /** Shift for the form of the current character. */
+  CURRENT_SHIFT: 12,
+};
+
+const joiningStates = [
+  "None", // Previous character doesn't join.
+  "Right", // Previous character only joins on its right side.
+  "Dual", // Previous character is isolated and joins on its left side.
+  "DualFinal", // Previous character is final and joins on its left side.
+  "AlaphFinal", // Previous character is a final Alaph.
+  "AlaphFin23", // Previous character is an Alaph in FIN2 or FIN3 form.
+  "DalathRish", // Previous character is Dalath or Rish.
+];
+
+/**
+ * Cursive joining rules (Core Specification section 9.2, Arabic and Syriac).
+ *
+ * @param state   Current state.
+ * @param cls     Joining class of next character.
+ */
+function joiningTransition(state, cls) {
+  const entry = (next, previous, current) => ({
+    next,
+    flags:
+      (joiningForms.indexOf(previous) << joiningFlags.PREVIOUS_SHIFT) |
+      (joiningForms.indexOf(current) << joiningFlags.CURRENT_SHIFT),
+  });
+
+  // Previous character joins on its left side: it becomes initial or medial.
+  const joins = state === "Dual" || state === "DualFinal";
+  const previous = {
+    Dual: "INIT",
+    DualFinal: "MEDI",
+    AlaphFinal: "MED2", // Alaph followed by a joining character.
+    AlaphFin23: "ISOL",
+  }[state] || "NONE";
+
+  switch (cls) {
+    case "T":
+      return entry(state, "NONE", "NONE");
+    case "U":
+      return entry("None", "NONE", "NONE");
+    case "L":
+      return entry("Dual", "NONE", "ISOL");
+    case "R":
+    case "D":
+    case "Dalath_Rish": {
+      const next = { R: "Right", D: "Dual", Dalath_Rish: "DalathRish" }[cls];
+      if (joins) {
+        return entry(next === "Dual" ? "DualFinal" : next, previous, "FINA");
+      }
+      return entry(next, previous, "ISOL");
+    }
+    case "Alaph":
+      if (joins) return entry("AlaphFinal", previous, "FINA");
+      if (state === "None") return entry("Right", "NONE", "ISOL");
+      return entry(
+        "AlaphFin23",
+        previous,
+        state === "DalathRish" ? "FIN3" : "FIN2"
+      );
+  }
+  throw new Error(`Unknown joining class ${cls}`);
+}
+
+/**
+ * Compile cursive joining rules.
+ *
+ * @param classes   Joining classes.
+ *
+ * @return { states, table, initial }
+ */
+export function compileJoining(classes) {
+  const table = compileTable(joiningStates, classes, joiningTransition);
+  return { states: joiningStates, table, initial: 0 };
+}
@@ -0,0 +1,194 @@
+/**
+ * @file ucdUtf8.js
+ *
+ * Codepoint sets compiled to UTF-8 byte-range automata, for byte-oriented
+ * matching engines.
+ *
+ * Codepoint ranges are first split into sequences of byte ranges so that each
+ * sequence covers codepoints of the same encoded length, with all trailing
+ * bytes spanning full continuation ranges where possible. Sequences are then
+ * added in ascending order to an incrementally built automaton that shares
+ * common prefixes and registers frozen states to share common suffixes
+ * (Daciuk et al., "Incremental Construction of Minimal Acyclic Finite-State
+ * Automata").
+ *
+ * MiniUCD_CompileUtf8Automaton() implements the same algorithm at runtime;
+ * both give identical tables.
+ */
+
+/** Target of transitions that complete a sequence. */
+export const UTF8_ACCEPT = 0;
+
+/** Largest codepoint encoded with 1, 2 and 3 bytes. */
+const UTF8_MAX = [0x7f, 0x7ff, 0xffff];
+
+/**
+ * Encode codepoint in UTF-8.
+ *
+ * @return Array of bytes.
+ */
+function encodeUtf8(c) {
+  if (c <= 0x7f) return [c];
+  if (c <= 0x7ff) return [0xc0 | (c >> 6), 0x80 | (c & 0x3f)];
+  if (c <= 0xffff) {
+    return [0xe0 | (c >> 12), 0x80 | ((c >> 6) & 0x3f), 0x80 | (c & 0x3f)];
+  }
+  return [
+    0xf0 | (c >> 18),
+    0x80 | ((c >> 12) & 0x3f),
+    0x80 | ((c >> 6) & 0x3f),
+    0x80 | (c & 0x3f),
+  ];
+}
+
+/**
+ * Split codepoint ranges into UTF-8 byte range sequences. Surrogates are
+ * excluded.
+ *
+ * @param ranges Sorted, disjoint codepoint ranges as [first, last] pairs.
+ *
+ * @return Array of sequences in ascending order, each sequence being an array
+ *         of [first, last] byte ranges.
+ */
+export function utf8Sequences(ranges) {
+  const sequences = [];
+  for (let [start, end] of ranges) {
+    const pending = [];
+    if (start >= 0xd800 && start <= 0xdfff) start = 0xe000;
+    if (end >= 0xd800 && end <= 0xdfff) end = 0xd7ff;
+    if (start > end) continue;
+    if (start < 0xd800 && end > 0xdfff) {
+      pending.push([0xe000, end]);
+      end = 0xd7ff;
+    }
+    pending.push([start, end]);
+
+    while (pending.length > 0) {
+      [start, end] = pending.pop();
+      split: for (;;) {
+        // Split at encoded length boundaries.
+        for (const max of UTF8_MAX) {
+          if (start <= max && max < end) {
+            pending.push([max + 1, end]);
+            end = max;
+            continue split;
+          }
+        }
+
+        // Split so that trailing bytes span full continuation ranges.
+        for (let i = 1; i < 4; i++) {
+          const mask = (1 << (6 * i)) - 1;
+          if ((start & ~mask) === (end & ~mask)) continue;
+          if ((start & mask) !== 0) {
+            pending.push([(start | mask) + 1, end]);
+            end = start | mask;
+            continue split;
+          }
+          if ((end & mask) !== mask) {
+            pending.push([end & ~mask, end]);
+            end = (end & ~mask) - 1;
+            continue split;
+          }
+        }
+
+        const first = encodeUtf8(start);
+        const last = encodeUtf8(end);
+        sequences.push(first.map((byte, i) => [byte, last[i]]));
+        break;
+      }
+    }
+  }
+  return sequences;
+}
+
+/**
+ * Compile codepoint ranges to a minimal UTF-8 byte-range automaton.
+ *
+ * States are stored as consecutive transitions, the last one of each state
+ * being flagged by `end`. The start state comes first; other states are
+ * referenced by the index of their first transition, and transitions to
+ * UTF8_ACCEPT complete a sequence. Within a state, adjacent byte ranges with
+ * the same target are merged. Empty sets give a start state with a single
+ * transition matching no byte.
+ *
+ * @param ranges Sorted, disjoint codepoint ranges as [first, last] pairs.
+ *
+ * @return Array of transitions as { first, last, end, next }.
+ */
+export function compileUtf8Automaton(ranges) {
+  // Targets are 1-based indices of compiled states until the start state gets
+  // moved in front, with zero for UTF8_ACCEPT.
+  const automaton = [];
+  const registry = new Map();
+  const compile = (transitions) => {
+    const key = transitions.map((t) => `${t.first}-${t.last}:${t.next}`).join();
+    if (!registry.has(key)) {
+      registry.set(key, automaton.length + 1);
+      transitions.forEach((t, i) =>
+        automaton.push({ ...t, end: i === transitions.length - 1 ? 1 : 0 })
+      );
+    }
+    return registry.get(key);
+  };
+  const addTransition = (node, first, last, next) => {
+    const previous = node.transitions[node.transitions.length - 1];
+    if (previous && previous.last + 1 === first && previous.next === next) {
+      previous.last = last;
+    } else {
+      node.transitions.push({ first, last, next });
+    }
+  };
+
+  // Uncompiled nodes along the last added sequence, starting from the root.
+  const nodes = [{ transitions: [], pending: null }];
+  const compileFrom = (depth) => {
+    let next = UTF8_ACCEPT;
+    while (nodes.length > depth + 1) {
+      const node = nodes.pop();
+      if (node.pending) {
+        addTransition(node, node.pending.first, node.pending.last, next);
+      }
+      next = node.transitions.length
+        ? compile(node.transitions)
+        : UTF8_ACCEPT;
+    }
+    const node = nodes[depth];
+    if (node.pending) {
+      addTransition(node, node.pending.first, node.pending.last, next);
+      node.pending = null;
+    }
+  };
+
+  for (const sequence of utf8Sequences(ranges)) {
+    // Share common prefix with the last added sequence.
+    let prefix = 0;
+    while (
+      prefix < sequence.length &&
+      prefix < nodes.length &&
+      nodes[prefix].pending &&
+      nodes[prefix].pending.first === sequence[prefix][0] &&
+      nodes[prefix].pending.last === sequence[prefix][1]
+    ) {
+      prefix++;
+    }
+    compileFrom(prefix);
+    for (let i = prefix; i < sequence.length; i++) {
+      const [first, last] = sequence[i];
+      nodes[i].pending = { first, last };
+      nodes.push({ transitions: [], pending: null });
+    }
+  }
+  compileFrom(0);
+  const root = nodes[0].transitions.length
+    ? nodes[0].transitions
+    : [{ first: 1, last: 0, next: UTF8_ACCEPT }];
+
+  // Move start state in front.
+  return [
+    ...root.map((t, i) => ({ ...t, end: i === root.length - 1 ? 1 : 0 })),
+    ...automaton,
+  ].map((t) => ({
+    ...t,
+    next: t.next === UTF8_ACCEPT ? t.next : t.next - 1 + root.length,
+  }));
+}